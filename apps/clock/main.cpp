@@ -6,6 +6,7 @@
 #include <M5Unified.h>
 #include <WiFi.h>
 #include <time.h>
+#include "fastmath.h"
 
 #define WIFI_SSID     "2532 Guest"
 #define WIFI_PASSWORD "aloha808"
@@ -74,15 +75,15 @@ void setup(void)
     clockbase.fillCircle(halfwidth, halfwidth, halfwidth, 6);
     clockbase.drawCircle(halfwidth, halfwidth, halfwidth - 1, 15);
     for (int i = 1; i <= 60; ++i) {
-        float rad = i * 6 * -0.0174532925;
-        float cosy = -cos(rad) * (halfwidth * 10 / 11);
-        float sinx = -sin(rad) * (halfwidth * 10 / 11);
+        uint16_t ang = -(i * FM_TURN / 60);
+        float cosy = -fmCos(ang) * (halfwidth * 10 / 11) * (1.0f / FM_ONE);
+        float sinx = -fmSin(ang) * (halfwidth * 10 / 11) * (1.0f / FM_ONE);
         bool flg = 0 == (i % 5);
         clockbase.fillCircle(halfwidth + sinx + 1, halfwidth + cosy + 1, flg * 3 + 1, 4);
         clockbase.fillCircle(halfwidth + sinx, halfwidth + cosy, flg * 3 + 1, 12);
         if (flg) {
-            cosy = -cos(rad) * (halfwidth * 10 / 13);
-            sinx = -sin(rad) * (halfwidth * 10 / 13);
+            cosy = -fmCos(ang) * (halfwidth * 10 / 13) * (1.0f / FM_ONE);
+            sinx = -fmSin(ang) * (halfwidth * 10 / 13) * (1.0f / FM_ONE);
             clockbase.setTextColor(1);
             clockbase.drawNumber(i / 5, halfwidth + sinx + 1, halfwidth + cosy + 4);
             clockbase.setTextColor(15);
@@ -164,9 +165,9 @@ void update7Seg(int32_t hour, int32_t min)
 void drawDot(int pos, int palette)
 {
     bool flg = 0 == (pos % 5);
-    float rad = pos * 6 * -0.0174532925;
-    float cosy = -cos(rad) * (halfwidth * 10 / 11);
-    float sinx = -sin(rad) * (halfwidth * 10 / 11);
+    uint16_t ang = -(pos * FM_TURN / 60);
+    float cosy = -fmCos(ang) * (halfwidth * 10 / 11) * (1.0f / FM_ONE);
+    float sinx = -fmSin(ang) * (halfwidth * 10 / 11) * (1.0f / FM_ONE);
     canvas.fillCircle(halfwidth + sinx, halfwidth + cosy, flg * 3 + 1, palette);
 }
 
@@ -1,9 +1,17 @@
 // Generative Art Frame — M5Stack CoreS3 SE
-// 4 visual modes: Plasma, Flow Field Particles, Moiré Rings, Cellular Drift
+// 9 visual modes: Plasma, Flow Field Particles, Moiré Rings, Cellular Drift,
+// Reaction-Diffusion, Tunnel, Metaballs, Voronoi, SDF Raymarch
 // Touch to cycle modes. NeoPixels ambient glow. Runs forever as desk art.
 
 #include <M5Unified.h>
 #include <FastLED.h>
+#include "jobs.h"
+#include "quad_field.h"
+#include "fastmath.h"
+#include "prng.h"
+#include "governor.h"
+#include "strips.h"
+#include "luts.h"
 
 // --- Hardware ---
 static M5GFX& lcd = M5.Display;
@@ -18,35 +26,167 @@ static CRGB leds[NUM_LEDS];
 #define SCR_W 320
 #define SCR_H 240
 
-// --- LUTs (SRAM) ---
-static uint8_t sinLUT[256];          // sin*127+128
-static uint8_t fadeLUT[256];         // RGB332 fade for particle trails
+// --- LUTs ---
+// sinLUT, fadeLUT, caReact, identityLUT and the palettes are generated
+// into flash by gen_luts.py (luts.h)
 
 // --- Palette system ---
 static uint8_t currentPalette[256];  // RGB332
-static uint8_t palA[256], palB[256]; // source palettes for cross-fade
+static uint8_t palA[256];            // cross-fade source: snapshot of currentPalette
+static const uint8_t* palB = artPalettes[1];  // cross-fade target, read from flash
 static float palBlend = 0.0f;
 static int palIdxA = 0, palIdxB = 1;
-#define NUM_PALETTES 6
-
-// --- Distance LUT (PSRAM) ---
-static uint8_t* distLUT = nullptr;   // SCR_W * SCR_H
+#define NUM_PALETTES NUM_ART_PALETTES
+
+// --- Distance LUT (SRAM) ---
+// Distance from center, stored as one 161x121 quadrant and mirrored
+static QuadField<SCR_W, SCR_H> distField;
+
+// --- Plasma per-frame terms (SRAM) ---
+static uint8_t plasmaCol[SCR_W];           // x-only term
+static uint8_t plasmaDiag[SCR_W + SCR_H];  // (x + y) term
+
+// --- Palette-cycle rendering ---
+// Plasma and moiré write 8-bit palette indices into one full-frame index
+// buffer and only re-render it every PALCYCLE_GEOM_FRAMES frames. In
+// between, all motion comes from the 256-entry palette, so those frames
+// skip the per-pixel kernel. The pixels still have to be converted and
+// sent: with strips (strips.h) the cached indices go through the strip
+// table and out by DMA, otherwise the buffer is a palettized sprite and
+// LGFX expands it on the CPU during pushSprite().
+#define PALETTE_CYCLE        1
+#define PALCYCLE_GEOM_FRAMES 4
+static LGFX_Sprite _idxSprite;
+static int palGeomAge = 0;           // frames since indices were rendered
+
+// --- Tunnel tables + texture ---
+// Per-pixel angle and depth packed into one quadrant table entry
+// (angle << 8 | depth), mirrored at lookup like distField. The texture
+// holds palette indices, so it follows currentPalette for free.
+#define TUNNEL_TEX      256          // texture is TUNNEL_TEX x TUNNEL_TEX, wraps both ways
+#define TUNNEL_DEPTH_K  4096         // depth = K / radius; radius < 16 px is the far end
+#define TUNNEL_FOG      16           // shade levels, picked by depth >> 4
+typedef QuadField<SCR_W, SCR_H, uint16_t> TunnelField;
+static TunnelField* tunnelQuad = nullptr;
+static uint8_t* tunnelTex = nullptr;
+static int tunnelRows = 0;           // prewarm rows built so far (quadrant, then texture)
+static uint8_t tunnelShade[TUNNEL_FOG][256];  // currentPalette, dimmed per fog level
+
+// --- Moiré ring sources + shifted distance table (SRAM, PSRAM fallback) ---
+// moireDist[|dy| * SCR_W + |dx|] holds the ring distance for any offset
+// on screen; each source reads it at its own shift, one load per pixel.
+// It stays a full SCR_W x SCR_H table: sources sit anywhere on screen,
+// so |dx| runs up to SCR_W - 1 and a QuadField doesn't cover it.
+#define MOIRE_SOURCES 4   // any count works, cost is linear
+#define MOIRE_EUCLID  0   // 1 = true circular rings, same per-pixel cost
+static uint8_t* moireDist = nullptr;
+static int moireRows = 0;             // rows of moireDist built so far
 
 // --- Cellular automaton buffers (PSRAM) ---
-#define CA_W 160
-#define CA_H 120
+#define CA_SCALE 2                   // 2 = 160x120 grid upscaled, 1 = full 320x240
+#define CA_W (SCR_W / CA_SCALE)
+#define CA_H (SCR_H / CA_SCALE)
 static uint8_t* caA = nullptr;
 static uint8_t* caB = nullptr;
 
-// --- Particles ---
-#define MAX_PARTICLES 500
-struct Particle {
-  float x, y, vx, vy;
+// --- Gray-Scott reaction-diffusion (Q4.12 fields, SRAM if it fits) ---
+#define RD_SCALE 2                   // 2 = 160x120 grid upscaled, 1 = full 320x240
+#define RD_W (SCR_W / RD_SCALE)
+#define RD_H (SCR_H / RD_SCALE)
+#define RD_STEPS 8                   // simulation steps per displayed frame
+#define RD_ONE 4096                  // 1.0 in Q4.12
+#define RD_SEEDS 12                  // square V patches dropped at init
+static int16_t* rdU[2] = { nullptr, nullptr };  // ping-pong: [rdCur] is current
+static int16_t* rdV[2] = { nullptr, nullptr };
+static int rdCur = 0;
+static int rdPreset = 0;             // feed/kill pair, advances per visit
+static int16_t rdSeedX[RD_SEEDS], rdSeedY[RD_SEEDS];
+
+// --- Metaballs ---
+// The screen is cut into tiles; a tile only renders if some ball's
+// bounding box touches it, and only tiles lit now or in the frame on
+// screen are pushed over SPI.
+#define META_BALLS   20                 // capacity; metaCount are live
+#define META_FRAC    6                  // 1/64 px positions
+#define META_R_MIN   20                 // influence radius range, px
+#define META_R_MAX   44
+#define META_EDGE    128                // field level of the blob surface
+#define META_TILE_W  32
+#define META_TILE_H  16
+#define META_TILES_X (SCR_W / META_TILE_W)
+#define META_TILES_Y (SCR_H / META_TILE_H)
+struct Metaball {
+  int32_t x, y;                         // 1/64 px
+  int16_t vx, vy;                       // 1/64 px per frame
+  int16_t r;                            // influence radius, px: field is zero beyond
+};
+static Metaball metaBalls[META_BALLS];
+static int metaCount = 12;              // governed, up to META_BALLS
+static uint8_t metaLit[2][META_TILES_Y][META_TILES_X];  // per sprite: tile holds pixels
+static bool metaFullPush = false;       // next push covers the whole screen
+
+// --- Voronoi (jump flooding) ---
+// vorId holds the nearest seed per cell of a 160x120 grid, ping-pong.
+// Each frame starts from the last frame's answer, so a few short JFA
+// passes are enough; only the first solve runs the full pass ladder.
+#define VOR_SCALE  2                   // grid cell = 2x2 screen px
+#define VOR_W      (SCR_W / VOR_SCALE)
+#define VOR_H      (SCR_H / VOR_SCALE)
+#define VOR_SEEDS  384                 // up to 65535
+#define VOR_FRAC   4                   // seed positions in 1/16 cell
+#define VOR_NONE   0xFFFF              // no seed known yet
+static const uint8_t vorReuseSteps[] = { 2, 1 };         // per frame
+static const uint8_t vorFullSteps[] = { 128, 64, 32, 16, 8, 4, 2, 1, 1 };  // first solve (JFA+1)
+static uint16_t* vorId[2] = { nullptr, nullptr };
+static int vorCur = 0;
+static int16_t vorX[VOR_SEEDS], vorY[VOR_SEEDS];   // 1/16 cell
+static int8_t vorVX[VOR_SEEDS], vorVY[VOR_SEEDS];  // 1/16 cell per frame
+static uint8_t vorColor[VOR_SEEDS];                // palette index per seed
+
+// --- SDF raymarcher (Q12 world, 2x2 temporal interleave) ---
+// Each frame marches one cell of every 2x2 block; the other three are
+// reprojected from the previous frame through its depth. sdfLevels
+// trade internal resolution and march steps for render time; the
+// governor picks one.
+#define SDF_MAX_W       160
+#define SDF_MAX_H       120
+struct SdfLevel { uint8_t scale, steps; };  // screen px per cell, march steps per ray
+static const SdfLevel sdfLevels[] = { { 4, 16 }, { 4, 28 }, { 2, 20 }, { 2, 32 }, { 2, 48 } };
+#define SDF_LEVELS (int)(sizeof(sdfLevels) / sizeof(sdfLevels[0]))
+struct SdfCamera {
+  int32_t pos[3];                    // Q12
+  int32_t right[3], up[3], fwd[3];   // Q14, unit
+  int w, h, focal;                   // cells
 };
-static Particle particles[MAX_PARTICLES];
+static uint8_t* sdfVal[2] = { nullptr, nullptr };   // material << 5 | light, ping-pong
+static uint16_t* sdfZ[2] = { nullptr, nullptr };    // depth along the view axis, Q12
+static int sdfCur = 0;
+static SdfCamera sdfCam[2];          // sdfCam[i] is the view sdfVal[i] was drawn from
+static int sdfLevel = 2;             // governed, index into sdfLevels
+static uint32_t sdfPhase = 0;
+static int32_t sdfBall[3][3];        // sphere centers this frame, Q12
+
+// --- Particles (structure of arrays, Q10.6 fixed-point positions) ---
+#define MAX_PARTICLES 10000
+#define PART_FRAC 6                      // 1/64 px position resolution
+static uint16_t* partX = nullptr;        // internal SRAM if it fits
+static uint16_t* partY = nullptr;
+static int partCount = MAX_PARTICLES;    // governed
+
+// --- Flow field grid (SRAM) ---
+// noise2d sampled every 8 px; particles interpolate between nodes
+#define FLOW_CELL_SHIFT 3
+#define FLOW_GW ((SCR_W >> FLOW_CELL_SHIFT) + 1)  // 41 nodes
+#define FLOW_GH ((SCR_H >> FLOW_CELL_SHIFT) + 1)  // 31 nodes
+#define FLOW_ROWS_PER_FRAME 4                     // full refresh every ~8 frames
+#define FLOW_ONE 1024                             // velocity scale: px/frame * 1024
+static int16_t flowVX[FLOW_GH][FLOW_GW];
+static int16_t flowVY[FLOW_GH][FLOW_GW];
+static int flowRow = 0;                           // next grid row to refresh
 
 // --- Mode management ---
-enum Mode { MODE_PLASMA = 0, MODE_PARTICLES, MODE_MOIRE, MODE_CELLULAR, MODE_COUNT };
+enum Mode { MODE_PLASMA = 0, MODE_PARTICLES, MODE_MOIRE, MODE_CELLULAR, MODE_REACTION,
+            MODE_TUNNEL, MODE_METABALLS, MODE_VORONOI, MODE_SDF, MODE_COUNT };
 static Mode currentMode = MODE_PLASMA;
 static uint32_t modeStartTime = 0;
 static uint32_t modeDuration = 0;   // ms
@@ -54,11 +194,38 @@ static bool transitioning = false;
 static int transPhase = 0;          // 0=fade out, 1=fade in
 static uint32_t transStart = 0;
 #define TRANS_DURATION 1000          // ms per fade phase
+static Mode nextMode = MODE_PLASMA;  // chosen at transition start
+static int prewarmPos = 0;           // init progress of nextMode
+static bool prewarmDone = false;
 
 // --- Timing ---
 static uint32_t frameCount = 0;
 static float timeS = 0.0f;
 
+// --- Random streams, one per mode (prng.h) ---
+#define PRNG_SEED 0  // 0 = new sequence every boot, else replay the same run
+static Prng rngParticles, rngCA, rngReaction, rngMeta, rngVoronoi;
+static Prng rngSystem;  // mode durations
+
+// Serial frame-time report at the end of every transition
+#define ENABLE_PERF_LOG 0
+#if ENABLE_PERF_LOG
+static uint32_t perfLastUs = 0;
+static uint32_t perfSteadyUs = 0;  // EMA of frame time outside transitions
+static uint32_t perfWorstUs = 0;   // worst frame since transition start
+static uint32_t perfRenderUs = 0;  // EMA of the outgoing mode's render call
+static uint32_t palGeomUs = 0;     // palette-cycled frame time (render + push) EMAs:
+static uint32_t palOnlyUs = 0;     // indices re-rendered, palette only
+#endif
+
+// CSV sample (clock, frame times, battery current) over serial every
+// POWER_TRACE_MS, for power_trace.py
+#define ENABLE_POWER_TRACE 0
+#define POWER_TRACE_MS 1000
+#if ENABLE_POWER_TRACE
+static uint32_t traceLastMs = 0;
+#endif
+
 // --- NeoPixel smoothing ---
 static uint8_t neoR[NUM_LEDS], neoG[NUM_LEDS], neoB[NUM_LEDS];
 
@@ -88,48 +255,8 @@ static inline uint8_t rgb332_dim(uint8_t c, uint8_t factor) {
 }
 
 // ============================================================
-// Palette generation
+// Palette cross-fade
 // ============================================================
-static void generatePalette(uint8_t* pal, int idx) {
-  // Each palette: base hue, hue range, saturation range, value range
-  struct PalDef { float hBase, hRange, sMin, sMax, vMin, vMax; };
-  static const PalDef defs[NUM_PALETTES] = {
-    { 0,    40,  0.7f, 1.0f, 0.4f, 1.0f },  // ember
-    { 160, 60,  0.5f, 0.9f, 0.3f, 1.0f },   // ocean
-    { 80,  120, 0.6f, 1.0f, 0.3f, 1.0f },    // aurora
-    { 10,  50,  0.7f, 1.0f, 0.5f, 1.0f },    // sunset
-    { 200, 160, 0.8f, 1.0f, 0.5f, 1.0f },    // neon
-    { 100, 40,  0.4f, 0.8f, 0.3f, 0.9f },    // moss
-  };
-  const PalDef& d = defs[idx % NUM_PALETTES];
-
-  for (int i = 0; i < 256; i++) {
-    float t = i / 255.0f;
-    // Sine-based variation for smooth cycling
-    float h = fmodf(d.hBase + d.hRange * sinf(t * M_PI * 2.0f), 360.0f);
-    if (h < 0) h += 360.0f;
-    float s = d.sMin + (d.sMax - d.sMin) * (0.5f + 0.5f * sinf(t * M_PI * 3.0f));
-    float v = d.vMin + (d.vMax - d.vMin) * (0.5f + 0.5f * cosf(t * M_PI * 2.5f));
-
-    // HSV to RGB
-    float c = v * s;
-    float x = c * (1.0f - fabsf(fmodf(h / 60.0f, 2.0f) - 1.0f));
-    float m = v - c;
-    float rf, gf, bf;
-    if (h < 60)       { rf = c; gf = x; bf = 0; }
-    else if (h < 120) { rf = x; gf = c; bf = 0; }
-    else if (h < 180) { rf = 0; gf = c; bf = x; }
-    else if (h < 240) { rf = 0; gf = x; bf = c; }
-    else if (h < 300) { rf = x; gf = 0; bf = c; }
-    else               { rf = c; gf = 0; bf = x; }
-
-    uint8_t r8 = (uint8_t)((rf + m) * 255);
-    uint8_t g8 = (uint8_t)((gf + m) * 255);
-    uint8_t b8 = (uint8_t)((bf + m) * 255);
-    pal[i] = rgb332(r8, g8, b8);
-  }
-}
-
 static void updatePalette() {
   // Cross-fade between palA and palB
   palBlend += 0.00055f; // ~30s for full transition at 60fps
@@ -138,7 +265,7 @@ static void updatePalette() {
     palIdxA = palIdxB;
     palIdxB = (palIdxB + 1) % NUM_PALETTES;
     memcpy(palA, currentPalette, 256);
-    generatePalette(palB, palIdxB);
+    palB = artPalettes[palIdxB];
   }
 
   uint8_t blendB = (uint8_t)(palBlend * 255);
@@ -158,28 +285,10 @@ static void updatePalette() {
 // LUT initialization
 // ============================================================
 static void initLUTs() {
-  // Sin LUT
-  for (int i = 0; i < 256; i++) {
-    sinLUT[i] = (uint8_t)(127.0f * sinf(i * M_PI * 2.0f / 256.0f) + 128);
-  }
-
-  // Fade LUT — dim each RGB332 color to ~85%
-  for (int i = 0; i < 256; i++) {
-    fadeLUT[i] = rgb332_dim(i, 216);
-  }
-
-  // Distance LUT (from center) — PSRAM
-  distLUT = (uint8_t*)ps_malloc(SCR_W * SCR_H);
-  if (distLUT) {
-    int cx = SCR_W / 2, cy = SCR_H / 2;
-    for (int y = 0; y < SCR_H; y++) {
-      for (int x = 0; x < SCR_W; x++) {
-        int dx = x - cx, dy = y - cy;
-        float d = sqrtf(dx * dx + dy * dy);
-        distLUT[y * SCR_W + x] = (uint8_t)((int)d & 0xFF);
-      }
-    }
-  }
+  // Distance LUT (from center) — one quadrant, mirrored at lookup. Kept
+  // in SRAM: plasma reads it for every pixel, and 19.5 KB of flash reads
+  // would thrash the cache. Building it is integer-only and cheap.
+  distField.buildDistance();
 }
 
 // ============================================================
@@ -233,159 +342,436 @@ static float noise2d(float x, float y) {
 // ============================================================
 // Particle init
 // ============================================================
-static void initParticles() {
-  for (int i = 0; i < MAX_PARTICLES; i++) {
-    particles[i].x = random(0, SCR_W);
-    particles[i].y = random(0, SCR_H);
-    particles[i].vx = 0;
-    particles[i].vy = 0;
+// Init particles [from, to) — split so it can run across several frames
+static void initParticles(int from, int to) {
+  if (!partX) {
+    size_t bytes = MAX_PARTICLES * sizeof(uint16_t);
+    partX = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    partY = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!partX) partX = (uint16_t*)ps_malloc(bytes);
+    if (!partY) partY = (uint16_t*)ps_malloc(bytes);
+  }
+  for (int i = from; i < to; i++) {
+    partX[i] = prngRange(rngParticles, 0, SCR_W << PART_FRAC);
+    partY[i] = prngRange(rngParticles, 0, SCR_H << PART_FRAC);
+  }
+}
+
+// Sample the noise field into grid rows [from, to)
+static void refreshFlowRows(int from, int to) {
+  const float noiseScale = 0.008f;
+  float noiseZ = timeS * 0.15f;
+  for (int gy = from; gy < to; gy++) {
+    float ny = (gy << FLOW_CELL_SHIFT) * noiseScale + noiseZ;
+    for (int gx = 0; gx < FLOW_GW; gx++) {
+      uint16_t a = fmAngle(noise2d((gx << FLOW_CELL_SHIFT) * noiseScale, ny) * M_PI * 4.0f);
+      flowVX[gy][gx] = (int16_t)((fmCos(a) * (FLOW_ONE * 3 / 2)) >> 15);
+      flowVY[gy][gx] = (int16_t)((fmSin(a) * (FLOW_ONE * 3 / 2)) >> 15);
+    }
   }
 }
 
 // ============================================================
 // Cellular automaton init
 // ============================================================
-static void initCA() {
+// Seed rows [from, to) — split so it can run across several frames
+static void initCA(int from, int to) {
   if (!caA) caA = (uint8_t*)ps_malloc(CA_W * CA_H);
   if (!caB) caB = (uint8_t*)ps_malloc(CA_W * CA_H);
   // Random seed
-  for (int i = 0; i < CA_W * CA_H; i++) {
-    caA[i] = random(0, 256);
+  prngFill(rngCA, caA + from * CA_W, (to - from) * CA_W);
+  memcpy(caB + from * CA_W, caA + from * CA_W, (to - from) * CA_W);
+}
+
+// ============================================================
+// Reaction-diffusion init
+// ============================================================
+// Rows [from, to): U = 1, V = 0, plus a few square patches of V that
+// the reaction grows from. from == 0 picks the patches and the preset.
+static void initReaction(int from, int to) {
+  for (int i = 0; i < 2; i++) {
+    size_t bytes = RD_W * RD_H * sizeof(int16_t);
+    if (!rdU[i]) rdU[i] = (int16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!rdV[i]) rdV[i] = (int16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!rdU[i]) rdU[i] = (int16_t*)ps_malloc(bytes);
+    if (!rdV[i]) rdV[i] = (int16_t*)ps_malloc(bytes);
+  }
+  if (from == 0) {
+    rdCur = 0;
+    rdPreset++;
+    for (int i = 0; i < RD_SEEDS; i++) {
+      rdSeedX[i] = prngRange(rngReaction, 0, RD_W);
+      rdSeedY[i] = prngRange(rngReaction, 0, RD_H);
+    }
+  }
+  const int r = 4 / RD_SCALE + 2;
+  for (int y = from; y < to; y++) {
+    int16_t* u = rdU[rdCur] + y * RD_W;
+    int16_t* v = rdV[rdCur] + y * RD_W;
+    for (int x = 0; x < RD_W; x++) { u[x] = RD_ONE; v[x] = 0; }
+    for (int i = 0; i < RD_SEEDS; i++) {
+      if (y < rdSeedY[i] - r || y > rdSeedY[i] + r) continue;
+      for (int x = rdSeedX[i] - r; x <= rdSeedX[i] + r; x++) {
+        int wx = (x + RD_W) % RD_W;
+        u[wx] = RD_ONE / 2;
+        v[wx] = RD_ONE / 4 + prngRange(rngReaction, 0, RD_ONE / 8);
+      }
+    }
   }
-  memcpy(caB, caA, CA_W * CA_H);
 }
 
 // ============================================================
 // Mode: Plasma Waves
 // ============================================================
-static void renderPlasma(uint8_t* buf) {
+// t4 only shifts the sum before the final sin pass, so it lives in the
+// palette: pal[i] = currentPalette[sinLUT[i + t4]]
+static void plasmaPalette(uint8_t* pal) {
+  uint16_t t4 = (uint16_t)(timeS * 17.0f);
+  for (int i = 0; i < 256; i++) pal[i] = currentPalette[sinLUT[(uint8_t)(i + t4)]];
+}
+
+// Per-frame terms, shared by every row
+static uint16_t plasmaT2;
+static void plasmaFrame() {
   uint16_t t1 = (uint16_t)(timeS * 47.0f);  // irrational-ish ratios
-  uint16_t t2 = (uint16_t)(timeS * 31.0f);
   uint16_t t3 = (uint16_t)(timeS * 23.0f);
-  uint16_t t4 = (uint16_t)(timeS * 17.0f);
+  plasmaT2 = (uint16_t)(timeS * 31.0f);
 
-  for (int y = 0; y < SCR_H; y++) {
-    uint8_t sy = sinLUT[(y + t2) & 0xFF];
-    for (int x = 0; x < SCR_W; x++) {
-      uint8_t v = sinLUT[(x + t1) & 0xFF];
-      v += sy;
-      v += sinLUT[((x + y + t3) >> 1) & 0xFF];
-      if (distLUT) v += distLUT[y * SCR_W + x] + t4;
-      v = sinLUT[v & 0xFF]; // final pass through sin for smoothing
-      buf[y * SCR_W + x] = currentPalette[v];
+  // Factor out everything that doesn't depend on both x and y:
+  //   v = col[x] + diag[x + y] + dist(x, y) + sinLUT[y + t2]
+  // and look v up in pal (final sin pass + t4 + palette).
+  for (int x = 0; x < SCR_W; x++) plasmaCol[x] = sinLUT[(x + t1) & 0xFF];
+  for (int k = 0; k < SCR_W + SCR_H - 1; k++) plasmaDiag[k] = sinLUT[((k + t3) >> 1) & 0xFF];
+}
+
+// Rows [y0, y1) into dst, SCR_W bytes per row
+static void plasmaBand(uint8_t* dst, const uint8_t* pal, int y0, int y1) {
+  for (int y = y0; y < y1; y++) {
+    uint8_t base = sinLUT[(y + plasmaT2) & 0xFF];
+    const uint8_t* dq = distField.row(y);
+    const uint8_t* col = plasmaCol;
+    const uint8_t* diag = plasmaDiag + y;
+    uint32_t* out = (uint32_t*)(dst + (y - y0) * SCR_W);
+
+    // 4 pixels per iteration, one 32-bit store. Left half walks the
+    // quadrant backwards (|dx| = 160 - x), right half forwards.
+    for (int x = 0; x < SCR_W / 2; x += 4) {
+      const uint8_t* d = dq + (SCR_W / 2 - x);
+      *out++ =  (uint32_t)pal[(uint8_t)(col[x]     + diag[x]     + d[0]  + base)]
+             | ((uint32_t)pal[(uint8_t)(col[x + 1] + diag[x + 1] + d[-1] + base)] << 8)
+             | ((uint32_t)pal[(uint8_t)(col[x + 2] + diag[x + 2] + d[-2] + base)] << 16)
+             | ((uint32_t)pal[(uint8_t)(col[x + 3] + diag[x + 3] + d[-3] + base)] << 24);
+    }
+    for (int x = SCR_W / 2; x < SCR_W; x += 4) {
+      const uint8_t* d = dq + (x - SCR_W / 2);
+      *out++ =  (uint32_t)pal[(uint8_t)(col[x]     + diag[x]     + d[0] + base)]
+             | ((uint32_t)pal[(uint8_t)(col[x + 1] + diag[x + 1] + d[1] + base)] << 8)
+             | ((uint32_t)pal[(uint8_t)(col[x + 2] + diag[x + 2] + d[2] + base)] << 16)
+             | ((uint32_t)pal[(uint8_t)(col[x + 3] + diag[x + 3] + d[3] + base)] << 24);
     }
   }
 }
 
+static void renderPlasma(uint8_t* buf, const uint8_t* pal) {
+  plasmaFrame();
+  jobsFor(SCR_H, [&](int y0, int y1) { plasmaBand(buf + y0 * SCR_W, pal, y0, y1); });
+}
+
 // ============================================================
-// Mode: Flow Field Particles
+// Mode: Tunnel
 // ============================================================
-static void renderParticles(uint8_t* buf) {
-  // Fade existing trails
-  int total = SCR_W * SCR_H;
-  for (int i = 0; i < total; i++) {
-    buf[i] = fadeLUT[buf[i]];
+// Build rows [from, to) of the quadrant table, then of the texture:
+// rows < TunnelField::QH are quadrant rows, the next TUNNEL_TEX are
+// texture rows. Both are kept, so only the first visit pays.
+static void initTunnel(int from, int to) {
+  if (!tunnelQuad) {
+    tunnelQuad = (TunnelField*)heap_caps_malloc(sizeof(TunnelField), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!tunnelQuad) tunnelQuad = (TunnelField*)ps_malloc(sizeof(TunnelField));
+  }
+  if (!tunnelTex) {
+    tunnelTex = (uint8_t*)heap_caps_malloc(TUNNEL_TEX * TUNNEL_TEX, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!tunnelTex) tunnelTex = (uint8_t*)ps_malloc(TUNNEL_TEX * TUNNEL_TEX);
+  }
+  if (!tunnelQuad || !tunnelTex) return;
+
+  const int qh = TunnelField::QH;
+  for (int r = from; r < to; r++) {
+    if (r < qh) {
+      // Angle: atan2(|dy|, |dx|) in 1/256 turns (0..64); the render
+      // loop mirrors it per quadrant. Depth: K / radius with the radius
+      // in 1/16 px, so rings near the vanishing point don't band.
+      int dy = r;
+      uint16_t* q = tunnelQuad->q[dy];
+      for (int dx = 0; dx < TunnelField::QW; dx++) {
+        uint32_t a = (fmAtan2(dy, dx) + 128) >> 8;
+        uint32_t r16 = fmIsqrt((uint32_t)(dx * dx + dy * dy) << 8);
+        uint32_t d = r16 ? ((uint32_t)TUNNEL_DEPTH_K << 4) / r16 : 255;
+        q[dx] = (uint16_t)((a << 8) | (d > 255 ? 255 : d));
+      }
+    } else {
+      // Wavy bands over an XOR grid; every term has a period that
+      // divides 256, so the texture tiles seamlessly
+      int v = r - qh;
+      uint8_t* t = tunnelTex + v * TUNNEL_TEX;
+      uint8_t warp = sinLUT[(uint8_t)(v * 2)] >> 2;
+      for (int u = 0; u < TUNNEL_TEX; u++) {
+        t[u] = (uint8_t)(((u ^ v) >> 1) + (sinLUT[(uint8_t)(u * 4 + warp)] >> 1));
+      }
+    }
   }
+  if (to > tunnelRows) tunnelRows = to;
+}
 
-  float noiseScale = 0.008f;
-  float noiseZ = timeS * 0.15f;
+// Fog folded into the palette: one 256-entry table per depth band, so
+// shading costs the pixel loop nothing extra. The last band is black
+// and forms the vanishing point.
+static void tunnelPalette() {
+  const int last = TUNNEL_FOG - 1;
+  for (int i = 0; i < 256; i++) tunnelShade[0][i] = currentPalette[i];
+  for (int f = 1; f < TUNNEL_FOG; f++) {
+    uint8_t dim = (uint8_t)(255 - f * f * 255 / (last * last));  // quadratic falloff
+    for (int i = 0; i < 256; i++) tunnelShade[f][i] = rgb332_dim(currentPalette[i], dim);
+  }
+}
+
+static bool tunnelReady() {
+  return tunnelQuad && tunnelTex && tunnelRows >= TunnelField::QH + TUNNEL_TEX;
+}
 
-  for (int i = 0; i < MAX_PARTICLES; i++) {
-    Particle& p = particles[i];
-
-    // Sample noise field for velocity
-    float angle = noise2d(p.x * noiseScale, p.y * noiseScale + noiseZ) * M_PI * 4.0f;
-    p.vx = cosf(angle) * 1.5f;
-    p.vy = sinf(angle) * 1.5f;
-
-    p.x += p.vx;
-    p.y += p.vy;
-
-    // Wrap around
-    if (p.x < 0) p.x += SCR_W;
-    if (p.x >= SCR_W) p.x -= SCR_W;
-    if (p.y < 0) p.y += SCR_H;
-    if (p.y >= SCR_H) p.y -= SCR_H;
-
-    // Color by position in field
-    uint8_t cidx = (uint8_t)((int)(p.x + p.y * 0.7f + timeS * 20) & 0xFF);
-    int px = (int)p.x;
-    int py = (int)p.y;
-    if (px >= 0 && px < SCR_W && py >= 0 && py < SCR_H) {
-      buf[py * SCR_W + px] = currentPalette[cidx];
+// Per-frame fog palette and texture offsets
+static uint8_t tunnelV, tunnelU;
+static void tunnelFrame() {
+  tunnelPalette();
+  tunnelV = (uint8_t)(timeS * 48.0f);  // forward motion
+  tunnelU = (uint8_t)(timeS * 13.0f + (fmSin(fmAngle(timeS * 0.4f)) >> 9));  // roll
+}
+
+// Rows [y0, y1) into dst, SCR_W bytes per row.
+// Per pixel: one table load (angle + depth), one texel, one shade.
+// Angle mirrors per quadrant: u = uShift ± a on the right half,
+// uShift + 128 ∓ a on the left; the sign flips above the center row.
+static void tunnelBand(uint8_t* dst, int y0, int y1) {
+  if (!tunnelReady()) {
+    memset(dst, 0, (y1 - y0) * SCR_W);
+    return;
+  }
+  const uint8_t vShift = tunnelV, uShift = tunnelU;
+  for (int y = y0; y < y1; y++) {
+    const uint16_t* q = tunnelQuad->row(y);
+    const uint8_t (*shade)[256] = tunnelShade;
+    int sign = y < SCR_H / 2 ? -1 : 1;
+    uint8_t uL = (uint8_t)(uShift + 128), uR = uShift;
+    uint32_t* out = (uint32_t*)(dst + (y - y0) * SCR_W);
+    auto px = [&](uint16_t e, uint8_t u) -> uint32_t {
+      uint8_t d = (uint8_t)e;
+      uint8_t t = tunnelTex[(uint8_t)(d + vShift) * TUNNEL_TEX + u];
+      return shade[d >> 4][t];
+    };
+
+    for (int x = 0; x < SCR_W / 2; x += 4) {
+      const uint16_t* e = q + (SCR_W / 2 - x);
+      uint32_t w = 0;
+      for (int j = 0; j < 4; j++) {
+        w |= px(e[-j], (uint8_t)(uL - sign * (e[-j] >> 8))) << (8 * j);
+      }
+      *out++ = w;
+    }
+    for (int x = SCR_W / 2; x < SCR_W; x += 4) {
+      const uint16_t* e = q + (x - SCR_W / 2);
+      uint32_t w = 0;
+      for (int j = 0; j < 4; j++) {
+        w |= px(e[j], (uint8_t)(uR + sign * (e[j] >> 8))) << (8 * j);
+      }
+      *out++ = w;
     }
   }
 }
 
+static void renderTunnel(uint8_t* buf) {
+  if (!tunnelReady()) return;
+  tunnelFrame();
+  jobsFor(SCR_H, [&](int y0, int y1) { tunnelBand(buf + y0 * SCR_W, y0, y1); });
+}
+
+// ============================================================
+// Mode: Flow Field Particles
+// ============================================================
+static void renderParticles(uint8_t* buf) {
+  // Fade existing trails
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int i = y0 * SCR_W; i < y1 * SCR_W; i++) {
+      buf[i] = fadeLUT[buf[i]];
+    }
+  });
+
+  // Keep the grid tracking noiseZ, a few rows per frame
+  int end = flowRow + FLOW_ROWS_PER_FRAME;
+  if (end > FLOW_GH) end = FLOW_GH;
+  refreshFlowRows(flowRow, end);
+  flowRow = end < FLOW_GH ? end : 0;
+
+  const int wrapX = SCR_W << PART_FRAC;
+  const int wrapY = SCR_H << PART_FRAC;
+  const int cellShift = FLOW_CELL_SHIFT + PART_FRAC;  // position -> cell
+  const int cellOne = 1 << cellShift;
+  const int velShift = 2 * cellShift + 4;  // lerp weights + FLOW_ONE -> 1/64 px
+  int tColor = (int)(timeS * 20);
+
+  jobsFor(partCount, [&](int i0, int i1) {
+    for (int i = i0; i < i1; i++) {
+      int x = partX[i], y = partY[i];
+
+      // Bilinear velocity lookup, all integer
+      int cx = x >> cellShift, cy = y >> cellShift;
+      int fx = x & (cellOne - 1), fy = y & (cellOne - 1);
+      const int16_t* vx0 = &flowVX[cy][cx];
+      const int16_t* vx1 = &flowVX[cy + 1][cx];
+      const int16_t* vy0 = &flowVY[cy][cx];
+      const int16_t* vy1 = &flowVY[cy + 1][cx];
+      int32_t tx = vx0[0] * (cellOne - fx) + vx0[1] * fx;
+      int32_t bx = vx1[0] * (cellOne - fx) + vx1[1] * fx;
+      int32_t ty = vy0[0] * (cellOne - fx) + vy0[1] * fx;
+      int32_t by = vy1[0] * (cellOne - fx) + vy1[1] * fx;
+      x += (tx * (cellOne - fy) + bx * fy) >> velShift;
+      y += (ty * (cellOne - fy) + by * fy) >> velShift;
+
+      // Wrap around
+      if (x < 0) x += wrapX;
+      if (x >= wrapX) x -= wrapX;
+      if (y < 0) y += wrapY;
+      if (y >= wrapY) y -= wrapY;
+      partX[i] = x;
+      partY[i] = y;
+
+      // Color by position in field (x + 0.7y)
+      uint8_t cidx = (uint8_t)(((x + ((y * 179) >> 8)) >> PART_FRAC) + tColor);
+      buf[(y >> PART_FRAC) * SCR_W + (x >> PART_FRAC)] = currentPalette[cidx];
+    }
+  }, 500);
+}
+
 // ============================================================
 // Mode: Moiré Ring Interference
 // ============================================================
-static void renderMoire(uint8_t* buf) {
-  // 4 ring sources on Lissajous paths
-  struct Source { float x, y; };
-  Source src[4];
-  for (int i = 0; i < 4; i++) {
-    float phase = i * M_PI * 0.5f;
+// Build distance table rows [from, to) — split so it can run across
+// several frames
+static void initMoire(int from, int to) {
+  if (!moireDist) {
+    moireDist = (uint8_t*)heap_caps_malloc(SCR_W * SCR_H, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!moireDist) moireDist = (uint8_t*)ps_malloc(SCR_W * SCR_H);
+  }
+  if (!moireDist) return;
+  for (int dy = from; dy < to; dy++) {
+    for (int dx = 0; dx < SCR_W; dx++) {
+#if MOIRE_EUCLID
+      int d = fmIsqrt(dx * dx + dy * dy);
+#else
+      // Octagonal distance approximation
+      int mn = dx < dy ? dx : dy;
+      int mx = dx > dy ? dx : dy;
+      int d = mx + (mn >> 1);
+#endif
+      moireDist[dy * SCR_W + dx] = (uint8_t)(d & 0xFF);
+    }
+  }
+  if (to > moireRows) moireRows = to;
+}
+
+// Palette rotation folded into the lookup: pal[i] = currentPalette[i + shift]
+static void moirePalette(uint8_t* pal) {
+  uint8_t palShift = (uint8_t)(timeS * 30.0f);
+  for (int i = 0; i < 256; i++) pal[i] = currentPalette[(uint8_t)(i + palShift)];
+}
+
+static bool moireReady() {
+  return moireDist && moireRows >= SCR_H;
+}
+
+// Ring sources on Lissajous paths, placed once per frame
+static int moireSrcX[MOIRE_SOURCES], moireSrcY[MOIRE_SOURCES];
+static void moireFrame() {
+  for (int i = 0; i < MOIRE_SOURCES; i++) {
+    float phase = i * M_PI * 2.0f / MOIRE_SOURCES;
     float freqX = 0.3f + i * 0.17f;
     float freqY = 0.23f + i * 0.13f;
-    src[i].x = SCR_W * 0.5f + SCR_W * 0.35f * sinf(timeS * freqX + phase);
-    src[i].y = SCR_H * 0.5f + SCR_H * 0.35f * cosf(timeS * freqY + phase * 1.3f);
-  }
-
-  uint8_t palShift = (uint8_t)(timeS * 30.0f); // palette rotation
-
-  for (int y = 0; y < SCR_H; y++) {
-    for (int x = 0; x < SCR_W; x++) {
-      uint16_t sum = 0;
-      for (int i = 0; i < 4; i++) {
-        // Octagonal distance approximation (no sqrt)
-        int dx = abs(x - (int)src[i].x);
-        int dy = abs(y - (int)src[i].y);
-        int mn = dx < dy ? dx : dy;
-        int mx = dx > dy ? dx : dy;
-        uint8_t d = (uint8_t)((mx + (mn >> 1)) & 0xFF);
-        sum += d;
-      }
-      buf[y * SCR_W + x] = currentPalette[(uint8_t)(sum + palShift)];
+    int sx = SCR_W / 2 + ((SCR_W * 35 / 100 * fmSin(fmAngle(timeS * freqX + phase))) >> 15);
+    int sy = SCR_H / 2 + ((SCR_H * 35 / 100 * fmCos(fmAngle(timeS * freqY + phase * 1.3f))) >> 15);
+    moireSrcX[i] = sx < 0 ? 0 : (sx >= SCR_W ? SCR_W - 1 : sx);
+    moireSrcY[i] = sy < 0 ? 0 : (sy >= SCR_H ? SCR_H - 1 : sy);
+  }
+}
+
+// Rows [y0, y1) into dst, SCR_W bytes per row
+static void moireBand(uint8_t* dst, const uint8_t* pal, int y0, int y1) {
+  if (!moireReady()) {
+    memset(dst, 0, (y1 - y0) * SCR_W);
+    return;
+  }
+  uint8_t sum[SCR_W];
+  for (int y = y0; y < y1; y++) {
+    memset(sum, 0, SCR_W);
+    // Each source is a shifted read of the same table row: backwards
+    // left of the source (|dx| = sx - x), forwards right of it
+    for (int i = 0; i < MOIRE_SOURCES; i++) {
+      int dy = y - moireSrcY[i];
+      const uint8_t* row = moireDist + (dy < 0 ? -dy : dy) * SCR_W;
+      int sx = moireSrcX[i];
+      const uint8_t* left = row + sx;
+      for (int x = 0; x < sx; x++) sum[x] += left[-x];
+      for (int x = sx; x < SCR_W; x++) sum[x] += row[x - sx];
     }
+    uint8_t* out = dst + (y - y0) * SCR_W;
+    for (int x = 0; x < SCR_W; x++) out[x] = pal[sum[x]];
   }
 }
 
+static void renderMoire(uint8_t* buf, const uint8_t* pal) {
+  if (!moireReady()) return;
+  moireFrame();
+  jobsFor(SCR_H, [&](int y0, int y1) { moireBand(buf + y0 * SCR_W, pal, y0, y1); });
+}
+
 // ============================================================
 // Mode: Cellular Drift
 // ============================================================
 static void renderCellular(uint8_t* buf) {
   if (!caA || !caB) return;
 
-  // Step CA
-  uint8_t* src = caA;
+  // Step CA: the [1 2 1] x [1 2 1] kernel is separable, so each source
+  // row is summed horizontally once and three rolling row sums give the
+  // vertical pass. Row sums live on the stack (internal SRAM).
+  const uint8_t* src = caA;
   uint8_t* dst = caB;
 
-  for (int y = 1; y < CA_H - 1; y++) {
-    for (int x = 1; x < CA_W - 1; x++) {
-      // Weighted neighbor average
-      uint16_t sum = (uint16_t)src[(y-1)*CA_W + x-1] + (uint16_t)src[(y-1)*CA_W + x]*2 + (uint16_t)src[(y-1)*CA_W + x+1]
-                   + (uint16_t)src[y*CA_W + x-1]*2     + (uint16_t)src[y*CA_W + x]*4     + (uint16_t)src[y*CA_W + x+1]*2
-                   + (uint16_t)src[(y+1)*CA_W + x-1] + (uint16_t)src[(y+1)*CA_W + x]*2 + (uint16_t)src[(y+1)*CA_W + x+1];
-      uint8_t avg = sum >> 4; // divide by 16
-
-      // Nonlinear S-curve reaction: push away from middle
-      int v = avg;
-      if (v > 128) v = v + ((v - 128) >> 2);
-      else         v = v - ((128 - v) >> 2);
-      if (v > 255) v = 255;
-      if (v < 0) v = 0;
-      dst[y * CA_W + x] = (uint8_t)v;
+  // Interior rows 1..CA_H-2, split across cores
+  jobsFor(CA_H - 2, [&](int r0, int r1) {
+    uint16_t rows[3][CA_W];
+    auto hsum = [&](uint16_t* h, int y) {
+      const uint8_t* s = src + y * CA_W;
+      for (int x = 1; x < CA_W - 1; x++) h[x] = s[x - 1] + 2 * s[x] + s[x + 1];
+    };
+    uint16_t* h0 = rows[0];
+    uint16_t* h1 = rows[1];
+    uint16_t* h2 = rows[2];
+    hsum(h0, r0);
+    hsum(h1, r0 + 1);
+    for (int y = r0 + 1; y < r1 + 1; y++) {
+      hsum(h2, y + 1);
+      uint8_t* d = dst + y * CA_W;
+      for (int x = 1; x < CA_W - 1; x++) {
+        d[x] = caReact[(h0[x] + 2 * h1[x] + h2[x]) >> 4];
+      }
+      uint16_t* t = h0; h0 = h1; h1 = h2; h2 = t;
     }
-  }
+  });
 
   // Random perturbation
-  if (random(0, 10) == 0) {
-    int rx = random(4, CA_W - 4);
-    int ry = random(4, CA_H - 4);
+  if (prngBelow(rngCA, 10) == 0) {
+    int rx = prngRange(rngCA, 4, CA_W - 4);
+    int ry = prngRange(rngCA, 4, CA_H - 4);
     for (int dy = -3; dy <= 3; dy++)
       for (int dx = -3; dx <= 3; dx++)
-        dst[(ry + dy) * CA_W + rx + dx] = random(0, 256);
+        dst[(ry + dy) * CA_W + rx + dx] = prngNext(rngCA);
   }
 
   // Swap buffers
@@ -393,20 +779,649 @@ static void renderCellular(uint8_t* buf) {
   caA = dst;
   caB = tmp;
 
-  // Upscale 2x to sprite buffer
-  for (int y = 0; y < CA_H; y++) {
-    int sy = y * 2;
-    for (int x = 0; x < CA_W; x++) {
-      uint8_t c = currentPalette[caA[y * CA_W + x]];
-      int sx = x * 2;
-      buf[sy * SCR_W + sx] = c;
-      buf[sy * SCR_W + sx + 1] = c;
-      buf[(sy + 1) * SCR_W + sx] = c;
-      buf[(sy + 1) * SCR_W + sx + 1] = c;
+  // Palette map (and upscale) to sprite buffer, 32-bit stores
+  const uint8_t* ca = caA;
+  jobsFor(CA_H, [&](int y0, int y1) {
+    for (int y = y0; y < y1; y++) {
+      const uint8_t* s = ca + y * CA_W;
+      uint32_t* out = (uint32_t*)(buf + y * CA_SCALE * SCR_W);
+#if CA_SCALE == 2
+      // Two cells -> four pixels per store, then duplicate the row
+      for (int x = 0; x < CA_W; x += 2) {
+        uint32_t c0 = currentPalette[s[x]];
+        uint32_t c1 = currentPalette[s[x + 1]];
+        *out++ = (c0 | (c0 << 8)) | ((c1 | (c1 << 8)) << 16);
+      }
+      memcpy(buf + (y * 2 + 1) * SCR_W, buf + y * 2 * SCR_W, SCR_W);
+#else
+      for (int x = 0; x < CA_W; x += 4) {
+        *out++ =  (uint32_t)currentPalette[s[x]]
+               | ((uint32_t)currentPalette[s[x + 1]] << 8)
+               | ((uint32_t)currentPalette[s[x + 2]] << 16)
+               | ((uint32_t)currentPalette[s[x + 3]] << 24);
+      }
+#endif
+    }
+  });
+}
+
+// ============================================================
+// Mode: Reaction-Diffusion (Gray-Scott)
+// ============================================================
+// du = Du*lap(u) - u*v*v + F*(1 - u)
+// dv = Dv*lap(v) + u*v*v - (F + K)*v
+// Integer-only: Q4.12 fields, Q.12 coefficients, dt = 1, 5-point
+// Laplacian on a torus. Feed/kill pairs (Pearson's classes):
+struct RDPreset { int16_t feed, kill; };
+static const RDPreset rdPresets[] = {
+  { 152, 254 },   // F .037 K .062 — spots splitting (mitosis)
+  { 225, 254 },   // F .055 K .062 — coral
+  { 160, 238 },   // F .039 K .058 — worms / labyrinth
+  { 115, 233 },   // F .028 K .057 — wandering stripes
+};
+#define RD_DU 819   // 0.20
+#define RD_DV 410   // 0.10
+
+// One step of rows [r0, r1). Source rows are copied into three rolling
+// padded row buffers on the stack (internal SRAM), so each source row is
+// read from the field once and x wraps without branches. If out is set,
+// V is also mapped through currentPalette into the sprite.
+static void rdStepRows(int cur, int r0, int r1, uint8_t* out) {
+  const int16_t* su = rdU[cur];
+  const int16_t* sv = rdV[cur];
+  int16_t* du = rdU[cur ^ 1];
+  int16_t* dv = rdV[cur ^ 1];
+  const RDPreset& p = rdPresets[rdPreset % (sizeof(rdPresets) / sizeof(rdPresets[0]))];
+  const int feed = p.feed, feedKill = p.feed + p.kill;
+
+  int16_t bu[3][RD_W + 2], bv[3][RD_W + 2];
+  auto load = [&](int k, int y) {
+    y = (y + RD_H) % RD_H;
+    memcpy(&bu[k][1], su + y * RD_W, RD_W * sizeof(int16_t));
+    memcpy(&bv[k][1], sv + y * RD_W, RD_W * sizeof(int16_t));
+    bu[k][0] = bu[k][RD_W]; bu[k][RD_W + 1] = bu[k][1];
+    bv[k][0] = bv[k][RD_W]; bv[k][RD_W + 1] = bv[k][1];
+  };
+  int k0 = 0, k1 = 1, k2 = 2;
+  load(k0, r0 - 1);
+  load(k1, r0);
+  for (int y = r0; y < r1; y++) {
+    load(k2, y + 1);
+    const int16_t* un = bu[k0]; const int16_t* uc = bu[k1]; const int16_t* us = bu[k2];
+    const int16_t* vn = bv[k0]; const int16_t* vc = bv[k1]; const int16_t* vs = bv[k2];
+    int16_t* ou = du + y * RD_W;
+    int16_t* ov = dv + y * RD_W;
+    for (int x = 1; x <= RD_W; x++) {
+      int u = uc[x], v = vc[x];
+      int lu = un[x] + us[x] + uc[x - 1] + uc[x + 1] - 4 * u;
+      int lv = vn[x] + vs[x] + vc[x - 1] + vc[x + 1] - 4 * v;
+      int uvv = (((u * v) >> 12) * v) >> 12;
+      int nu = u + ((RD_DU * lu) >> 12) - uvv + ((feed * (RD_ONE - u)) >> 12);
+      int nv = v + ((RD_DV * lv) >> 12) + uvv - ((feedKill * v) >> 12);
+      ou[x - 1] = nu < 0 ? 0 : nu > RD_ONE ? RD_ONE : nu;
+      ov[x - 1] = nv < 0 ? 0 : nv > RD_ONE ? RD_ONE : nv;
+    }
+    if (out) {
+      // V rarely passes 0.5: index = v / 2048 * 255, saturated
+      uint32_t* o = (uint32_t*)(out + y * RD_SCALE * SCR_W);
+#if RD_SCALE == 2
+      for (int x = 0; x < RD_W; x += 2) {
+        int i0 = ov[x] >> 3, i1 = ov[x + 1] >> 3;
+        uint32_t c0 = currentPalette[i0 > 255 ? 255 : i0];
+        uint32_t c1 = currentPalette[i1 > 255 ? 255 : i1];
+        *o++ = (c0 | (c0 << 8)) | ((c1 | (c1 << 8)) << 16);
+      }
+      memcpy(out + (y * 2 + 1) * SCR_W, out + y * 2 * SCR_W, SCR_W);
+#else
+      for (int x = 0; x < RD_W; x += 4) {
+        uint32_t w = 0;
+        for (int j = 0; j < 4; j++) {
+          int i = ov[x + j] >> 3;
+          w |= (uint32_t)currentPalette[i > 255 ? 255 : i] << (8 * j);
+        }
+        *o++ = w;
+      }
+#endif
+    }
+    int t = k0; k0 = k1; k1 = k2; k2 = t;
+  }
+}
+
+static void renderReaction(uint8_t* buf) {
+  if (!rdU[1] || !rdV[1]) return;
+
+  // Each step is a barrier: every band of step n reads finished rows
+  // of step n-1. The last step also writes the sprite.
+  for (int s = 0; s < RD_STEPS; s++) {
+    uint8_t* out = s == RD_STEPS - 1 ? buf : nullptr;
+    int cur = rdCur;
+    jobsFor(RD_H, [&](int r0, int r1) { rdStepRows(cur, r0, r1, out); });
+    rdCur ^= 1;
+  }
+
+  // Occasional new V drop keeps the pattern from settling for good
+  if (prngBelow(rngReaction, 90) == 0) {
+    int cx = prngRange(rngReaction, 0, RD_W), cy = prngRange(rngReaction, 0, RD_H);
+    for (int dy = -3; dy <= 3; dy++) {
+      for (int dx = -3; dx <= 3; dx++) {
+        int i = ((cy + dy + RD_H) % RD_H) * RD_W + (cx + dx + RD_W) % RD_W;
+        rdU[rdCur][i] = RD_ONE / 2;
+        rdV[rdCur][i] = RD_ONE / 4;
+      }
+    }
+  }
+}
+
+// ============================================================
+// Mode: Metaballs
+// ============================================================
+static void initMetaballs() {
+  for (int i = 0; i < META_BALLS; i++) {
+    Metaball& b = metaBalls[i];
+    b.r = prngRange(rngMeta, META_R_MIN, META_R_MAX + 1);
+    b.x = prngRange(rngMeta, b.r, SCR_W - b.r) << META_FRAC;
+    b.y = prngRange(rngMeta, b.r, SCR_H - b.r) << META_FRAC;
+    b.vx = prngRange(rngMeta, 20, 70);
+    b.vy = prngRange(rngMeta, 20, 70);
+    if (prngBelow(rngMeta, 2)) b.vx = -b.vx;
+    if (prngBelow(rngMeta, 2)) b.vy = -b.vy;
+  }
+  memset(metaLit, 0, sizeof(metaLit));
+  metaFullPush = true;
+}
+
+// Field -> color: black at 0, a dim halo up to META_EDGE, then the
+// palette at full brightness, so the surface reads as a hard edge
+static void metaPalette(uint8_t* pal) {
+  for (int v = 0; v < META_EDGE; v++) {
+    pal[v] = rgb332_dim(currentPalette[v], (uint8_t)(v * v * 144 / (META_EDGE * META_EDGE)));
+  }
+  for (int v = META_EDGE; v < 256; v++) pal[v] = currentPalette[v];
+}
+
+static void renderMetaballs(uint8_t* buf) {
+  // Move: bounce so a ball's center stays on screen
+  const int32_t maxX = (SCR_W << META_FRAC) - 1, maxY = (SCR_H << META_FRAC) - 1;
+  for (int i = 0; i < metaCount; i++) {
+    Metaball& b = metaBalls[i];
+    b.x += b.vx;
+    b.y += b.vy;
+    if (b.x < 0)    { b.x = 0;    b.vx = -b.vx; }
+    if (b.x > maxX) { b.x = maxX; b.vx = -b.vx; }
+    if (b.y < 0)    { b.y = 0;    b.vy = -b.vy; }
+    if (b.y > maxY) { b.y = maxY; b.vy = -b.vy; }
+  }
+
+  // Per ball: center, radius and the falloff index scale, so a pixel
+  // costs d^2 * scale >> 16 and one table read — no divides
+  int cx[META_BALLS], cy[META_BALLS], r2[META_BALLS];
+  uint32_t scale[META_BALLS];
+  for (int i = 0; i < metaCount; i++) {
+    cx[i] = metaBalls[i].x >> META_FRAC;
+    cy[i] = metaBalls[i].y >> META_FRAC;
+    r2[i] = metaBalls[i].r * metaBalls[i].r;
+    scale[i] = (256u << 16) / r2[i];
+  }
+  uint8_t pal[256];
+  metaPalette(pal);
+  uint8_t (*lit)[META_TILES_X] = metaLit[_flip];
+
+  jobsFor(META_TILES_Y, [&](int t0, int t1) {
+    uint16_t field[META_TILE_H][META_TILE_W];
+    uint8_t list[META_BALLS];
+    for (int ty = t0; ty < t1; ty++) {
+      for (int tx = 0; tx < META_TILES_X; tx++) {
+        int x0 = tx * META_TILE_W, y0 = ty * META_TILE_H;
+        int n = 0;
+        for (int i = 0; i < metaCount; i++) {
+          int r = metaBalls[i].r;
+          if (cx[i] + r > x0 && cx[i] - r < x0 + META_TILE_W &&
+              cy[i] + r > y0 && cy[i] - r < y0 + META_TILE_H) list[n++] = i;
+        }
+        if (!n) {
+          // Nothing here: black the tile if this sprite still shows balls
+          if (lit[ty][tx]) {
+            for (int y = 0; y < META_TILE_H; y++) memset(buf + (y0 + y) * SCR_W + x0, 0, META_TILE_W);
+            lit[ty][tx] = 0;
+          }
+          continue;
+        }
+        lit[ty][tx] = 1;
+
+        // Sum each ball over the rows of its circle inside the tile
+        memset(field, 0, sizeof(field));
+        for (int k = 0; k < n; k++) {
+          int i = list[k];
+          for (int y = 0; y < META_TILE_H; y++) {
+            int dy = y0 + y - cy[i];
+            int rem = r2[i] - dy * dy;
+            if (rem <= 0) continue;
+            int half = fmIsqrt(rem);
+            int xa = cx[i] - half - x0, xb = cx[i] + half + 1 - x0;
+            if (xa < 0) xa = 0;
+            if (xb > META_TILE_W) xb = META_TILE_W;
+            uint16_t* f = field[y];
+            uint32_t dyy = dy * dy;
+            for (int x = xa; x < xb; x++) {
+              int dx = x0 + x - cx[i];
+              uint32_t t = ((dx * dx + dyy) * scale[i]) >> 16;
+              f[x] += metaFalloff[t > 255 ? 255 : t];
+            }
+          }
+        }
+
+        for (int y = 0; y < META_TILE_H; y++) {
+          const uint16_t* f = field[y];
+          uint32_t* out = (uint32_t*)(buf + (y0 + y) * SCR_W + x0);
+          for (int x = 0; x < META_TILE_W; x += 4) {
+            uint32_t w = 0;
+            for (int j = 0; j < 4; j++) w |= (uint32_t)pal[f[x + j] > 255 ? 255 : f[x + j]] << (8 * j);
+            *out++ = w;
+          }
+        }
+      }
+    }
+  }, 1);
+}
+
+// Push one rectangle of the sprite as a single transfer: the clip rect
+// lets pushSprite() send it with one address window
+static void pushSpriteRect(LGFX_Sprite& sp, int x, int y, int w, int h) {
+  lcd.setClipRect(x, y, w, h);
+  sp.pushSprite(&lcd, 0, 0);
+  lcd.clearClipRect();
+}
+
+// Push tiles lit in this frame or in the one on screen (which may
+// need blacking out), one rectangle per run of such tiles in a tile row
+static void pushMetaTiles(LGFX_Sprite& sp) {
+  if (metaFullPush) {
+    sp.pushSprite(&lcd, 0, 0);
+    metaFullPush = false;
+    return;
+  }
+  const uint8_t (*now)[META_TILES_X] = metaLit[_flip];
+  const uint8_t (*shown)[META_TILES_X] = metaLit[_flip ^ 1];
+  for (int ty = 0; ty < META_TILES_Y; ty++) {
+    int tx = 0;
+    while (tx < META_TILES_X) {
+      if (!now[ty][tx] && !shown[ty][tx]) { tx++; continue; }
+      int ts = tx;
+      while (tx < META_TILES_X && (now[ty][tx] || shown[ty][tx])) tx++;
+      pushSpriteRect(sp, ts * META_TILE_W, ty * META_TILE_H, (tx - ts) * META_TILE_W, META_TILE_H);
+    }
+  }
+  lcd.display();
+}
+
+// ============================================================
+// Mode: Voronoi (jump flooding)
+// ============================================================
+// Seeds, colors and an empty grid with every seed planted at its cell
+static void initVoronoi() {
+  size_t bytes = VOR_W * VOR_H * sizeof(uint16_t);
+  for (int i = 0; i < 2; i++) {
+    if (!vorId[i]) vorId[i] = (uint16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!vorId[i]) vorId[i] = (uint16_t*)ps_malloc(bytes);
+  }
+  if (!vorId[0] || !vorId[1]) return;
+  for (int i = 0; i < VOR_SEEDS; i++) {
+    vorX[i] = prngRange(rngVoronoi, 0, VOR_W << VOR_FRAC);
+    vorY[i] = prngRange(rngVoronoi, 0, VOR_H << VOR_FRAC);
+    vorVX[i] = prngRange(rngVoronoi, -6, 7);
+    vorVY[i] = prngRange(rngVoronoi, -6, 7);
+    vorColor[i] = prngBelow(rngVoronoi, 256);
+  }
+  vorCur = 0;
+  memset(vorId[0], 0xFF, bytes);
+  for (int i = 0; i < VOR_SEEDS; i++) {
+    vorId[0][(vorY[i] >> VOR_FRAC) * VOR_W + (vorX[i] >> VOR_FRAC)] = i;
+  }
+}
+
+// One JFA pass vorId[vorCur] -> vorId[vorCur ^ 1]: every cell keeps
+// the nearest of its own seed and those of the 8 cells `step` away.
+// Off-grid neighbours are clamped onto the cell itself, which the
+// c == best test then skips, so the inner loop has no bounds checks.
+static void vorPass(int step) {
+  const uint16_t* src = vorId[vorCur];
+  uint16_t* dst = vorId[vorCur ^ 1];
+  jobsFor(VOR_H, [&](int y0, int y1) {
+    for (int y = y0; y < y1; y++) {
+      int py = (y << VOR_FRAC) + (1 << (VOR_FRAC - 1));  // cell center
+      const uint16_t* rows[3] = {
+        src + (y - step >= 0 ? y - step : y) * VOR_W,
+        src + y * VOR_W,
+        src + (y + step < VOR_H ? y + step : y) * VOR_W,
+      };
+      for (int x = 0; x < VOR_W; x++) {
+        int px = (x << VOR_FRAC) + (1 << (VOR_FRAC - 1));
+        int xs[3] = { x - step >= 0 ? x - step : x, x, x + step < VOR_W ? x + step : x };
+        uint16_t best = rows[1][x];
+        int32_t bestD = INT32_MAX;
+        if (best != VOR_NONE) {
+          int dx = vorX[best] - px, dy = vorY[best] - py;
+          bestD = dx * dx + dy * dy;
+        }
+        for (int j = 0; j < 3; j++) {
+          for (int i = 0; i < 3; i++) {
+            uint16_t c = rows[j][xs[i]];
+            if (c == best || c == VOR_NONE) continue;
+            int dx = vorX[c] - px, dy = vorY[c] - py;
+            int32_t d = dx * dx + dy * dy;
+            if (d < bestD) { bestD = d; best = c; }
+          }
+        }
+        dst[y * VOR_W + x] = best;
+      }
     }
+  });
+  vorCur ^= 1;
+}
+
+static void renderVoronoi(uint8_t* buf) {
+  if (!vorId[0] || !vorId[1]) return;
+
+  // Drift the seeds (bouncing), then plant each at its new cell on top
+  // of last frame's answer, which is already right almost everywhere
+  const int maxX = (VOR_W << VOR_FRAC) - 1, maxY = (VOR_H << VOR_FRAC) - 1;
+  uint16_t* ids = vorId[vorCur];
+  for (int i = 0; i < VOR_SEEDS; i++) {
+    int x = vorX[i] + vorVX[i], y = vorY[i] + vorVY[i];
+    if (x < 0 || x > maxX) { vorVX[i] = -vorVX[i]; x = x < 0 ? 0 : maxX; }
+    if (y < 0 || y > maxY) { vorVY[i] = -vorVY[i]; y = y < 0 ? 0 : maxY; }
+    vorX[i] = x;
+    vorY[i] = y;
+    ids[(y >> VOR_FRAC) * VOR_W + (x >> VOR_FRAC)] = i;
+  }
+  for (uint8_t step : vorReuseSteps) vorPass(step);
+
+  // Palette per frame: cells dimmed, edges (a neighbour right or below
+  // belongs to another seed) at full brightness
+  uint8_t cellPal[256], edgePal[256];
+  for (int i = 0; i < 256; i++) {
+    edgePal[i] = currentPalette[i];
+    cellPal[i] = rgb332_dim(currentPalette[i], 150);
   }
+
+  // 2x upscale: each cell is one 16-bit pair in two screen rows
+  const uint16_t* id = vorId[vorCur];
+  jobsFor(VOR_H, [&](int y0, int y1) {
+    for (int y = y0; y < y1; y++) {
+      const uint16_t* row = id + y * VOR_W;
+      const uint16_t* below = y + 1 < VOR_H ? row + VOR_W : row;
+      uint16_t* out = (uint16_t*)(buf + y * 2 * SCR_W);
+      for (int x = 0; x < VOR_W; x++) {
+        uint16_t c = row[x];
+        bool edge = (x + 1 < VOR_W && row[x + 1] != c) || below[x] != c;
+        uint8_t col = c == VOR_NONE ? 0 : (edge ? edgePal : cellPal)[vorColor[c]];
+        out[x] = col | (col << 8);
+      }
+      memcpy(buf + (y * 2 + 1) * SCR_W, buf + y * 2 * SCR_W, SCR_W);
+    }
+  });
 }
 
+// ============================================================
+// Mode: SDF raymarcher
+// ============================================================
+// Three spheres circling a pillar over a checkered floor, sphere-traced
+// in Q12 (world units of 4096; directions Q14). Spheres are bounded
+// without a square root until one is close, the pillar is the cheap
+// max-of-planes box bound, and normals are analytic per material, so a
+// hit costs no extra SDF evaluations.
+// Shading is Lambert plus step-count occlusion, distance fog and blob
+// shadows under the spheres, quantized to material << 5 | light and
+// colored through currentPalette.
+//
+// The camera orbits. One cell per 2x2 block is marched per frame, in
+// the order (0,0) (1,1) (1,0) (0,1); every other cell takes its old
+// depth as a guess, moves that point into the previous camera's view
+// and copies the old cell it lands on if the depths agree (else keeps
+// its own). Errors only show at depth edges and on the moving spheres,
+// and are marched away within four frames.
+#define SDF_FAR   (15 << 12)         // rays past this see the sky
+#define SDF_SKY_Y (3 << 12)          // rays above this going up see the sky
+#define SDF_Q(v)  ((int32_t)((v) * 4096.0f))
+static const int32_t sdfRadius[3] = { SDF_Q(0.55f), SDF_Q(0.42f), SDF_Q(0.32f) };
+static const int32_t sdfLight[3] = { -7700, 12300, -6900 };  // unit, Q14, fixed in the world
+static const uint8_t sdfMatColor[8] = { 200, 48, 48, 0, 85, 150, 230, 0 };  // palette index per material
+enum { SDF_SKY = 0, SDF_FLOOR, SDF_FLOOR_DARK, SDF_BALL0, SDF_PILLAR = SDF_BALL0 + 3 };
+static int32_t sdfColVec[SDF_MAX_W][3], sdfRowVec[SDF_MAX_H][3];  // ray = col + row, Q14
+
+// Camera and spheres for time t, at the current level's resolution
+static void sdfSetup(SdfCamera& c, float t) {
+  const SdfLevel& lv = sdfLevels[sdfLevel];
+  c.w = SCR_W / lv.scale;
+  c.h = SCR_H / lv.scale;
+  c.focal = c.w * 7 / 8;             // ~60 degrees across
+  float a = t * 0.2f;
+  float px = 4.4f * sinf(a), py = 1.6f + 0.5f * sinf(t * 0.13f), pz = -4.4f * cosf(a);
+  float fx = -px, fy = 0.5f - py, fz = -pz;
+  float fl = 1.0f / sqrtf(fx * fx + fy * fy + fz * fz);
+  fx *= fl; fy *= fl; fz *= fl;
+  float rl = 1.0f / sqrtf(fx * fx + fz * fz);
+  float rx = fz * rl, rz = -fx * rl;                     // (0,1,0) x fwd
+  float ux = fy * rz, uy = fz * rx - fx * rz, uz = -fy * rx;  // fwd x right
+  c.pos[0] = SDF_Q(px); c.pos[1] = SDF_Q(py); c.pos[2] = SDF_Q(pz);
+  c.fwd[0] = fx * 16384; c.fwd[1] = fy * 16384; c.fwd[2] = fz * 16384;
+  c.right[0] = rx * 16384; c.right[1] = 0; c.right[2] = rz * 16384;
+  c.up[0] = ux * 16384; c.up[1] = uy * 16384; c.up[2] = uz * 16384;
+
+  for (int i = 0; i < 3; i++) {
+    float b = t * (0.7f + 0.25f * i) + i * 2.1f;
+    float r = 1.1f + 0.35f * i;
+    sdfBall[i][0] = SDF_Q(r * cosf(b));
+    sdfBall[i][1] = sdfRadius[i] + SDF_Q(0.6f * fabsf(sinf(t * (1.3f + 0.4f * i) + i)));
+    sdfBall[i][2] = SDF_Q(r * sinf(b));
+  }
+}
+
+static void initSdf() {
+  size_t cells = SDF_MAX_W * SDF_MAX_H;
+  for (int i = 0; i < 2; i++) {
+    if (!sdfVal[i]) sdfVal[i] = (uint8_t*)heap_caps_malloc(cells, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!sdfVal[i]) sdfVal[i] = (uint8_t*)ps_malloc(cells);
+    if (!sdfZ[i]) sdfZ[i] = (uint16_t*)heap_caps_malloc(cells * 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!sdfZ[i]) sdfZ[i] = (uint16_t*)ps_malloc(cells * 2);
+    if (!sdfVal[i] || !sdfZ[i]) return;
+    memset(sdfVal[i], 0, cells);
+    for (size_t k = 0; k < cells; k++) sdfZ[i][k] = SDF_FAR;
+  }
+  sdfSetup(sdfCam[sdfCur], timeS);   // the blank history's view
+  sdfPhase = 0;
+}
+
+// Scene distance at p (Q12) and the nearest material
+static inline int32_t sdfScene(const int32_t* p, int& mat) {
+  int32_t d = p[1];
+  mat = SDF_FLOOR;
+  int32_t qx = (p[0] < 0 ? -p[0] : p[0]) - SDF_Q(0.25f);
+  int32_t qy = (p[1] > SDF_Q(0.6f) ? p[1] - SDF_Q(0.6f) : SDF_Q(0.6f) - p[1]) - SDF_Q(0.6f);
+  int32_t qz = (p[2] < 0 ? -p[2] : p[2]) - SDF_Q(0.25f);
+  int32_t box = qx > qy ? qx : qy;
+  if (qz > box) box = qz;
+  if (box < d) { d = box; mat = SDF_PILLAR; }
+  for (int i = 0; i < 3; i++) {
+    int32_t dx = p[0] - sdfBall[i][0], dy = p[1] - sdfBall[i][1], dz = p[2] - sdfBall[i][2];
+    uint32_t ax = dx < 0 ? -dx : dx, ay = dy < 0 ? -dy : dy, az = dz < 0 ? -dz : dz;
+    // |p - c| is at least its projection on the axes, the face and the
+    // space diagonals: within 8%, no square root. Exact only once the
+    // sphere is close and might be nearest.
+    uint32_t mx = ax > ay ? ax : ay, mn = ax < ay ? ax : ay;
+    if (az > mx) mx = az;
+    if (az < mn) mn = az;
+    uint32_t sum = ax + ay + az;
+    uint32_t lo = ((sum - mn) * 46341) >> 16;     // / sqrt(2)
+    if (mx > lo) lo = mx;
+    uint32_t diag = (sum * 37837) >> 16;          // / sqrt(3)
+    if (diag > lo) lo = diag;
+    int32_t s = (int32_t)lo - sdfRadius[i];
+    if (s >= d) continue;
+    if (s < SDF_Q(0.25f)) s = (int32_t)fmIsqrt(ax * ax + ay * ay + az * az) - sdfRadius[i];
+    if (s < d) { d = s; mat = SDF_BALL0 + i; }
+  }
+  return d;
+}
+
+// March one ray along d (Q14, view axis component 1); depth out in zOut
+static uint8_t sdfTrace(const SdfCamera& c, const int32_t* d, int maxSteps, uint16_t& zOut) {
+  uint32_t len = fmIsqrt((uint32_t)(d[0] * d[0]) + (uint32_t)(d[1] * d[1]) + (uint32_t)(d[2] * d[2]));  // Q14
+  uint32_t inv = fmRecip(len);       // 2^18 / |d|
+  int32_t n[3];
+  for (int k = 0; k < 3; k++) n[k] = (int32_t)(((int64_t)d[k] * inv) >> 18);
+  int32_t p[3] = { c.pos[0], c.pos[1], c.pos[2] };
+  int32_t t = 0;
+  int mat = SDF_SKY, s = 0;
+  for (; s < maxSteps; s++) {
+    int32_t dist = sdfScene(p, mat);
+    if (dist < 16 + (t >> 8)) break;           // within ~1/256 of the distance
+    t += dist;
+    if (t > SDF_FAR || (p[1] > SDF_SKY_Y && n[1] >= 0)) { mat = SDF_SKY; break; }
+    for (int k = 0; k < 3; k++) p[k] += (dist * n[k]) >> 14;
+  }
+  if (mat == SDF_SKY) {
+    zOut = SDF_FAR;
+    return 8 + ((16384 - (n[1] > 0 ? n[1] : 0)) * 12 >> 14);  // lighter at the horizon
+  }
+  uint32_t z = (uint32_t)(((uint64_t)t * inv) >> 18);
+  zOut = z > 0xFFFF ? 0xFFFF : z;
+
+  // Analytic normal, Q14
+  int32_t nx = 0, ny = 16384, nz = 0;
+  if (mat >= SDF_BALL0 && mat < SDF_PILLAR) {
+    int i = mat - SDF_BALL0;
+    int32_t k = (16384 << 8) / sdfRadius[i];
+    nx = ((p[0] - sdfBall[i][0]) * k) >> 8;
+    ny = ((p[1] - sdfBall[i][1]) * k) >> 8;
+    nz = ((p[2] - sdfBall[i][2]) * k) >> 8;
+  } else if (mat == SDF_PILLAR) {
+    int32_t qx = (p[0] < 0 ? -p[0] : p[0]), qz = (p[2] < 0 ? -p[2] : p[2]);
+    if (p[1] > SDF_Q(1.18f)) { nx = 0; ny = 16384; }
+    else if (qx > qz) { nx = p[0] < 0 ? -16384 : 16384; ny = 0; }
+    else { nz = p[2] < 0 ? -16384 : 16384; ny = 0; }
+  }
+  int32_t lam = (nx * sdfLight[0] + ny * sdfLight[1] + nz * sdfLight[2]) >> 14;
+  int32_t light = 10 + (lam > 0 ? lam * 21 >> 14 : 0);
+  light -= light * s / (2 * maxSteps);          // many steps: grazing or a crevice
+  if (mat == SDF_FLOOR) {
+    if (((p[0] >> 12) ^ (p[2] >> 12)) & 1) mat = SDF_FLOOR_DARK;
+    for (int i = 0; i < 3; i++) {
+      int32_t dx = (p[0] - sdfBall[i][0]) >> 4, dz = (p[2] - sdfBall[i][2]) >> 4, r = sdfRadius[i] >> 4;
+      if (dx * dx + dz * dz < r * r) light >>= 1;
+    }
+  }
+  light = light * (SDF_FAR - t) / SDF_FAR;
+  if (light < 0) light = 0;
+  if (light > 31) light = 31;
+  return mat << 5 | light;
+}
+
+// Rows [y0, y1) of the new frame: march this phase's cells, reproject
+// the rest from the old frame
+static void sdfRows(int y0, int y1, int phase) {
+  const SdfCamera& nc = sdfCam[sdfCur ^ 1];
+  const SdfCamera& oc = sdfCam[sdfCur];
+  const uint8_t* oVal = sdfVal[sdfCur];
+  const uint16_t* oZ = sdfZ[sdfCur];
+  uint8_t* nVal = sdfVal[sdfCur ^ 1];
+  uint16_t* nZ = sdfZ[sdfCur ^ 1];
+  int steps = sdfLevels[sdfLevel].steps;
+  int px = phase == 1 || phase == 2, py = phase & 1;  // (0,0) (1,1) (1,0) (0,1)
+  int32_t delta[3] = { nc.pos[0] - oc.pos[0], nc.pos[1] - oc.pos[1], nc.pos[2] - oc.pos[2] };
+  for (int y = y0; y < y1; y++) {
+    int oy = y * oc.h / nc.h;        // same cell in the old grid (resolution may differ)
+    for (int x = 0; x < nc.w; x++) {
+      int32_t d[3] = { sdfColVec[x][0] + sdfRowVec[y][0], sdfColVec[x][1] + sdfRowVec[y][1],
+                       sdfColVec[x][2] + sdfRowVec[y][2] };
+      int i = y * nc.w + x;
+      if ((x & 1) == px && (y & 1) == py) {
+        nVal[i] = sdfTrace(nc, d, steps, nZ[i]);
+        continue;
+      }
+      int o = oy * oc.w + x * oc.w / nc.w;
+      int32_t z = oZ[o];
+      int32_t rel[3];
+      for (int k = 0; k < 3; k++) rel[k] = delta[k] + (int32_t)(((int64_t)z * d[k]) >> 14);
+      int32_t zo = (int32_t)(((int64_t)rel[0] * oc.fwd[0] + (int64_t)rel[1] * oc.fwd[1] + (int64_t)rel[2] * oc.fwd[2]) >> 14);
+      if (zo > 256) {
+        int32_t xo = (int32_t)(((int64_t)rel[0] * oc.right[0] + (int64_t)rel[2] * oc.right[2]) >> 14);
+        int32_t yo = (int32_t)(((int64_t)rel[0] * oc.up[0] + (int64_t)rel[1] * oc.up[1] + (int64_t)rel[2] * oc.up[2]) >> 14);
+        int64_t k = (int64_t)fmRecip(zo) * oc.focal;  // focal / zo, Q20
+        int sx = (int)(((oc.w << 15) + ((xo * k) >> 16)) >> 16);
+        int sy = (int)(((oc.h << 15) - ((yo * k) >> 16)) >> 16);
+        // Take the old cell only if it saw something at that depth;
+        // otherwise the guess crossed an edge, and chaining such copies
+        // would drag stale cells along
+        if (sx >= 0 && sx < oc.w && sy >= 0 && sy < oc.h) {
+          int q = sy * oc.w + sx, dz = oZ[q] - zo;
+          if ((dz < 0 ? -dz : dz) < (zo >> 4) + SDF_Q(0.05f)) o = q;
+        }
+      }
+      nVal[i] = oVal[o];
+      nZ[i] = oZ[o];
+    }
+  }
+}
+
+// One frame of the field at time t: new camera, march + reproject, flip
+static void sdfStep(float t) {
+  SdfCamera& nc = sdfCam[sdfCur ^ 1];
+  sdfSetup(nc, t);
+  // Ray for cell (x, y) = fwd + u * right + v * up, split into a column
+  // and a row term
+  for (int x = 0; x < nc.w; x++) {
+    int32_t u = (2 * x + 1 - nc.w) * 4096 / (2 * nc.focal);  // Q12
+    for (int k = 0; k < 3; k++) sdfColVec[x][k] = (u * nc.right[k]) >> 12;
+  }
+  for (int y = 0; y < nc.h; y++) {
+    int32_t v = (nc.h - 2 * y - 1) * 4096 / (2 * nc.focal);
+    for (int k = 0; k < 3; k++) sdfRowVec[y][k] = nc.fwd[k] + ((v * nc.up[k]) >> 12);
+  }
+  int phase = sdfPhase++ & 3;
+  jobsFor(nc.h, [&](int y0, int y1) { sdfRows(y0, y1, phase); }, 4);
+  sdfCur ^= 1;
+}
+
+static void renderSdf(uint8_t* buf) {
+  if (!sdfVal[0] || !sdfVal[1] || !sdfZ[0] || !sdfZ[1]) return;
+  sdfStep(timeS);
+
+  // material << 5 | light -> RGB332, following currentPalette
+  uint8_t color[256];
+  for (int m = 0; m < 8; m++) {
+    uint8_t base = currentPalette[sdfMatColor[m]];
+    int top = m == SDF_FLOOR_DARK ? 150 : 255;
+    for (int l = 0; l < 32; l++) color[m << 5 | l] = rgb332_dim(base, l * top / 31);
+  }
+
+  // Upscale: each cell fills scale x scale screen pixels
+  const SdfCamera& c = sdfCam[sdfCur];
+  const uint8_t* val = sdfVal[sdfCur];
+  int scale = SCR_W / c.w;
+  jobsFor(c.h, [&](int y0, int y1) {
+    for (int y = y0; y < y1; y++) {
+      const uint8_t* v = val + y * c.w;
+      uint8_t* out = buf + y * scale * SCR_W;
+      if (scale == 2) {
+        uint16_t* o = (uint16_t*)out;
+        for (int x = 0; x < c.w; x++) o[x] = color[v[x]] * 0x0101;
+      } else {
+        uint32_t* o = (uint32_t*)out;
+        for (int x = 0; x < c.w; x++) o[x] = color[v[x]] * 0x01010101u;
+      }
+      for (int r = 1; r < scale; r++) memcpy(out + r * SCR_W, out, SCR_W);
+    }
+  });
+}
+
+#if ENABLE_PERF_LOG
+static void sdfReport() {
+  const SdfLevel& lv = sdfLevels[sdfLevel];
+  Serial.printf("sdf: level %d (%dx%d, %d steps)\n", sdfLevel, SCR_W / lv.scale, SCR_H / lv.scale, lv.steps);
+}
+#endif
+
 // ============================================================
 // diffDraw — push only changed pixels
 // ============================================================
@@ -446,24 +1461,96 @@ static void startTransition() {
   transitioning = true;
   transPhase = 0;
   transStart = millis();
+  nextMode = (Mode)((currentMode + 1) % MODE_COUNT);
+  prewarmPos = 0;
+  prewarmDone = false;
+  // govFrame() is skipped until the next mode starts; the fade-out and
+  // prewarm get the top clock rather than whatever this mode settled on
+  govSetClock(GOV_CLOCKS - 1);
 }
 
-static void applyBrightness(uint8_t* buf, uint8_t brightness) {
-  int total = SCR_W * SCR_H;
-  for (int i = 0; i < total; i++) {
-    buf[i] = rgb332_dim(buf[i], brightness);
+static bool paletteCycled(Mode m) {
+  return PALETTE_CYCLE && _idxSprite.getBuffer() && (m == MODE_PLASMA || m == MODE_MOIRE);
+}
+
+// Modes whose every row is a function of per-frame terms alone render
+// in strips (strips.h) and never touch the full-frame sprites
+static bool stripRendered(Mode m) {
+  return stripsReady() && (m == MODE_PLASMA || m == MODE_MOIRE || m == MODE_TUNNEL);
+}
+
+// Render and push a strip-mode frame. Plasma and moiré write palette
+// indices and the tunnel RGB332; the palette and the fade both go into
+// the strip table. Palette-cycled plasma and moiré keep their indices in
+// idx and re-render them only when geom is set. Returns render time in us.
+static uint32_t pushStrips(Mode m, const uint8_t* pal, uint8_t brightness, uint8_t* idx, bool geom) {
+  uint8_t out[256];
+  if (m == MODE_TUNNEL) pal = identityLUT;
+  for (int i = 0; i < 256; i++) out[i] = brightness < 255 ? rgb332_dim(pal[i], brightness) : pal[i];
+  stripsPalette(out);
+  if (idx) {
+    return stripsPushFrom(lcd, SCR_H, SCR_H / 2, [&](int y0, int y1) {
+      uint8_t* dst = idx + y0 * SCR_W;
+      if (geom && m == MODE_PLASMA) plasmaBand(dst, identityLUT, y0, y1);
+      if (geom && m == MODE_MOIRE) moireBand(dst, identityLUT, y0, y1);
+      return (const uint8_t*)dst;
+    });
+  }
+  return stripsPush(lcd, SCR_H, SCR_H / 2, [&](uint8_t* dst, int y0, int y1) {
+    switch (m) {
+      case MODE_PLASMA: plasmaBand(dst, identityLUT, y0, y1); break;
+      case MODE_MOIRE:  moireBand(dst, identityLUT, y0, y1);  break;
+      default:          tunnelBand(dst, y0, y1);              break;
+    }
+  });
+}
+
+#if ENABLE_PERF_LOG
+// Frame time (render + push) of palette-cycled frames that re-rendered
+// the indices and of those that only changed the palette
+static void palCycleReport() {
+  Serial.printf("palcycle: geometry %lu us, palette-only %lu us (%s)\n", (unsigned long)palGeomUs,
+                (unsigned long)palOnlyUs, stripsReady() ? "strips" : "sprite");
+  palGeomUs = palOnlyUs = 0;
+}
+#endif
+
+// Present an index frame: dim the palette instead of the pixels, load
+// it into the palettized sprite and push; LGFX converts every pixel
+// through the palette on the way out. pal is left dimmed.
+static void pushPaletteFrame(uint8_t* pal, uint8_t brightness) {
+  for (int i = 0; i < 256; i++) {
+    uint8_t c = brightness < 255 ? rgb332_dim(pal[i], brightness) : pal[i];
+    pal[i] = c;
+    uint8_t r, g, b;
+    rgb332_unpack(c, r, g, b);
+    // Replicate the top bits so full-scale RGB332 maps to full-scale 888
+    _idxSprite.setPaletteColor(i, r | (r >> 3) | (r >> 6), g | (g >> 3) | (g >> 6),
+                               b | (b >> 2) | (b >> 4) | (b >> 6));
   }
+  _idxSprite.pushSprite(&lcd, 0, 0);
+}
+
+static void applyBrightness(uint8_t* buf, uint8_t brightness) {
+  // One 256-entry table per call instead of unpack/scale per pixel
+  uint8_t dimLUT[256];
+  for (int i = 0; i < 256; i++) dimLUT[i] = rgb332_dim(i, brightness);
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int i = y0 * SCR_W; i < y1 * SCR_W; i++) {
+      buf[i] = dimLUT[buf[i]];
+    }
+  });
 }
 
 // ============================================================
 // NeoPixel update — sample sprite buffer, EMA smooth
 // ============================================================
-static void updateNeoPixels(uint8_t* buf) {
-  // Sample 10 evenly spaced points along horizontal center
-  int sy = SCR_H / 2;
+static void updateNeoPixels(const uint8_t* row, const uint8_t* pal = nullptr) {
+  // Sample 10 evenly spaced points along the center row
   for (int i = 0; i < NUM_LEDS; i++) {
     int sx = (SCR_W * (i + 1)) / (NUM_LEDS + 1);
-    uint8_t c = buf[sy * SCR_W + sx];
+    uint8_t c = row[sx];
+    if (pal) c = pal[c];  // index frame
     uint8_t r, g, b;
     rgb332_unpack(c, r, g, b);
 
@@ -481,26 +1568,147 @@ static void updateNeoPixels(uint8_t* buf) {
 // Pick random mode duration (45-90 seconds)
 // ============================================================
 static uint32_t randomModeDuration() {
-  return random(45000, 90001);
+  return prngRange(rngSystem, 45000, 90001);
+}
+
+// ============================================================
+// Quality knobs per mode (governor.h)
+// ============================================================
+// The raymarch is the showcase: it holds a slower target and spends it
+// on grid resolution and march steps
+#define GOV_TARGET_US     33333  // 30 fps
+#define GOV_SDF_TARGET_US 50000  // 20 fps
+static const GovKnob govParticles[] = { { "particles", &partCount, 2000, MAX_PARTICLES, 1000 } };
+static const GovKnob govMeta[] = { { "balls", &metaCount, 6, META_BALLS, 2 } };
+static const GovKnob govSdf[] = { { "level", &sdfLevel, 0, SDF_LEVELS - 1, 1 } };
+static const GovMode govModes[MODE_COUNT] = {
+  { nullptr, 0, GOV_TARGET_US },           // plasma
+  { GOV_KNOBS(govParticles), GOV_TARGET_US },
+  { nullptr, 0, GOV_TARGET_US },           // moiré
+  { nullptr, 0, GOV_TARGET_US },           // cellular
+  { nullptr, 0, GOV_TARGET_US },           // reaction-diffusion
+  { nullptr, 0, GOV_TARGET_US },           // tunnel
+  { GOV_KNOBS(govMeta), GOV_TARGET_US },
+  { nullptr, 0, GOV_TARGET_US },           // voronoi
+  { GOV_KNOBS(govSdf), GOV_SDF_TARGET_US },
+};
+
+// ============================================================
+// Incremental mode init — runs in slices during the fade-out so
+// the switch frame costs no more than a normal frame
+// ============================================================
+#define PREWARM_PARTICLES 1000 // particles per fade-out frame
+#define PREWARM_CA_ROWS   20   // CA rows seeded per fade-out frame
+#define PREWARM_MOIRE_ROWS 40  // moiré distance rows per fade-out frame
+#define PREWARM_RD_ROWS   (RD_H / 6)  // reaction-diffusion rows per fade-out frame
+#define PREWARM_TUNNEL_ROWS 32 // tunnel quadrant/texture rows per fade-out frame
+#define VOR_FULL_PASSES (int)(sizeof(vorFullSteps) / sizeof(vorFullSteps[0]))
+
+// Run one slice of mode m's init. Returns true once m is ready.
+static bool prewarmSlice(Mode m, int& pos) {
+  int end;
+  switch (m) {
+    case MODE_PARTICLES:
+      if (pos < MAX_PARTICLES) {
+        end = pos + PREWARM_PARTICLES;
+        if (end > MAX_PARTICLES) end = MAX_PARTICLES;
+        initParticles(pos, end);
+      } else {
+        // Then the whole flow grid at the current noiseZ
+        end = pos + FLOW_ROWS_PER_FRAME;
+        if (end > MAX_PARTICLES + FLOW_GH) end = MAX_PARTICLES + FLOW_GH;
+        refreshFlowRows(pos - MAX_PARTICLES, end - MAX_PARTICLES);
+      }
+      pos = end;
+      return pos >= MAX_PARTICLES + FLOW_GH;
+    case MODE_CELLULAR:
+      end = pos + PREWARM_CA_ROWS;
+      if (end > CA_H) end = CA_H;
+      initCA(pos, end);
+      pos = end;
+      return pos >= CA_H;
+    case MODE_REACTION:
+      end = pos + PREWARM_RD_ROWS;
+      if (end > RD_H) end = RD_H;
+      initReaction(pos, end);
+      pos = end;
+      return pos >= RD_H;
+    case MODE_MOIRE:
+      // Table is built once and kept; later visits have nothing to do
+      if (moireRows >= SCR_H) return true;
+      end = pos + PREWARM_MOIRE_ROWS;
+      if (end > SCR_H) end = SCR_H;
+      initMoire(pos, end);
+      pos = end;
+      return pos >= SCR_H;
+    case MODE_METABALLS:
+      initMetaballs();
+      return true;
+    case MODE_VORONOI:
+      // Seeds first, then the full JFA ladder one pass per frame
+      if (pos == 0) initVoronoi();
+      else if (vorId[0] && vorId[1]) vorPass(vorFullSteps[pos - 1]);
+      pos++;
+      return pos > VOR_FULL_PASSES;
+    case MODE_SDF:
+      // Buffers, then one interleave phase per frame so every cell has
+      // been marched once before the mode shows
+      if (pos == 0) initSdf();
+      else if (sdfVal[0] && sdfVal[1] && sdfZ[0] && sdfZ[1]) sdfStep(timeS);
+      pos++;
+      return pos > 4;
+    case MODE_TUNNEL:
+      if (tunnelRows >= TunnelField::QH + TUNNEL_TEX) return true;
+      end = pos + PREWARM_TUNNEL_ROWS;
+      if (end > TunnelField::QH + TUNNEL_TEX) end = TunnelField::QH + TUNNEL_TEX;
+      initTunnel(pos, end);
+      pos = end;
+      return pos >= TunnelField::QH + TUNNEL_TEX;
+    default:
+      return true;
+  }
+}
+
+// Allocate the full-frame sprites, cleared, the first time a mode that
+// draws into them starts; strip modes never touch them
+static void spritesBegin() {
+  for (int i = 0; i < 2; i++) {
+    if (_sprites[i].getBuffer()) continue;
+    _sprites[i].setColorDepth(8);
+    if (!_sprites[i].createSprite(SCR_W, SCR_H)) {
+      _sprites[i].setPsram(true);
+      _sprites[i].createSprite(SCR_W, SCR_H);
+    }
+    _sprites[i].clear(0x00);
+  }
 }
 
 // ============================================================
 // Switch to next mode
 // ============================================================
-static void activateNextMode() {
-  currentMode = (Mode)((currentMode + 1) % MODE_COUNT);
+static void activateNextMode(uint8_t* buf) {
+  // Finish anything the fade-out didn't get to (only on very slow frames)
+  while (!prewarmDone) prewarmDone = prewarmSlice(nextMode, prewarmPos);
+
+  bool wasIdle = paletteCycled(currentMode) || stripRendered(currentMode);
+  currentMode = nextMode;
   modeStartTime = millis();
   modeDuration = randomModeDuration();
-
-  // Mode-specific init
-  if (currentMode == MODE_PARTICLES) {
-    initParticles();
-    // Clear both sprite buffers so trails start fresh
-    _sprites[0].clear(0x00);
-    _sprites[1].clear(0x00);
-  }
-  if (currentMode == MODE_CELLULAR) {
-    initCA();
+  palGeomAge = 0;
+  govSelect(&govModes[currentMode]);
+  if (!stripRendered(currentMode)) spritesBegin();
+
+  if (wasIdle) {
+    // The RGB332 sprites sat idle while the index sprite or the strips
+    // were on screen; clear them to match the black screen so diffDraw
+    // starts clean. buf is null if they were only allocated just now.
+    if (buf) memset(buf, 0, SCR_W * SCR_H);
+    _sprites[_flip ^ 1].clear(0x00);
+  } else if (currentMode == MODE_PARTICLES || currentMode == MODE_METABALLS) {
+    // Clear both sprite buffers so trails (particles) or unlit tiles
+    // (metaballs) start black; buf is faded to black this frame, so
+    // only the other one needs clearing
+    _sprites[_flip ^ 1].clear(0x00);
   }
 }
 
@@ -517,15 +1725,21 @@ void setup() {
     lcd.setRotation(lcd.getRotation() ^ 1);
   }
 
-  for (int i = 0; i < 2; i++) {
-    _sprites[i].setColorDepth(8);
-    if (!_sprites[i].createSprite(SCR_W, SCR_H)) {
-      _sprites[i].setPsram(true);
-      _sprites[i].createSprite(SCR_W, SCR_H);
+  // Strip bands first, so they get DMA-capable internal RAM; the
+  // sprites wait for the first mode that needs them
+  stripsBegin();
+  if (!stripRendered(currentMode)) spritesBegin();
+
+  // Index buffer for palette-cycled modes; a palettized sprite, so it can
+  // be pushed as it is when there are no strips
+  if (PALETTE_CYCLE) {
+    _idxSprite.setColorDepth(8);
+    if (!_idxSprite.createSprite(SCR_W, SCR_H)) {
+      _idxSprite.setPsram(true);
+      _idxSprite.createSprite(SCR_W, SCR_H);
     }
+    _idxSprite.createPalette();
   }
-  _sprites[0].clear(0x00);
-  _sprites[1].clear(0x00);
 
   // NeoPixels
   FastLED.addLeds<WS2812B, NEO_PIN, GRB>(leds, NUM_LEDS);
@@ -534,25 +1748,46 @@ void setup() {
   memset(neoG, 0, NUM_LEDS);
   memset(neoB, 0, NUM_LEDS);
 
+  // Second core for band-parallel kernels
+  jobsBegin();
+
+  // Random streams: same seed, one independent stream per mode
+  uint32_t seed = PRNG_SEED ? PRNG_SEED : esp_random();
+  prngSeed(rngParticles, seed, MODE_PARTICLES);
+  prngSeed(rngCA, seed, MODE_CELLULAR);
+  prngSeed(rngReaction, seed, MODE_REACTION);
+  prngSeed(rngMeta, seed, MODE_METABALLS);
+  prngSeed(rngVoronoi, seed, MODE_VORONOI);
+  prngSeed(rngSystem, seed, MODE_COUNT);
+
   // Init LUTs and palettes
+#if ENABLE_PERF_LOG
+  uint32_t bootUs = micros();
+#endif
   initLUTs();
-  generatePalette(palA, 0);
-  generatePalette(palB, 1);
+  memcpy(palA, artPalettes[0], 256);
   memcpy(currentPalette, palA, 256);
 
   // Init CA buffers
-  initCA();
+  initCA(0, CA_H);
 
   // Init particles
-  initParticles();
+  initParticles(0, MAX_PARTICLES);
+#if ENABLE_PERF_LOG
+  Serial.printf("boot: tables + mode state %lu us\n", (unsigned long)(micros() - bootUs));
+#endif
 
   // Start first mode
   modeStartTime = millis();
   modeDuration = randomModeDuration();
   currentMode = MODE_PLASMA;
+  govSelect(&govModes[currentMode]);
 
   // Hold startWrite for entire runtime (no SD card used)
   lcd.startWrite();
+#if ENABLE_PERF_LOG
+  perfLastUs = micros();
+#endif
 }
 
 // ============================================================
@@ -564,6 +1799,18 @@ void loop() {
   timeS = now * 0.001f;
   frameCount++;
 
+#if ENABLE_PERF_LOG
+  // Time of the previous frame (render + push + LEDs)
+  uint32_t nowUs = micros();
+  uint32_t frameUs = nowUs - perfLastUs;
+  perfLastUs = nowUs;
+  if (transitioning) {
+    if (frameUs > perfWorstUs) perfWorstUs = frameUs;
+  } else {
+    perfSteadyUs = perfSteadyUs ? (perfSteadyUs * 15 + frameUs) >> 4 : frameUs;
+  }
+#endif
+
   // --- Touch: cycle mode ---
   auto touch = M5.Touch.getDetail();
   if (touch.wasPressed()) {
@@ -583,50 +1830,130 @@ void loop() {
   // --- Render current mode into sprite ---
   LGFX_Sprite& sp = _sprites[_flip];
   uint8_t* buf = (uint8_t*)sp.getBuffer();
-
+  uint8_t* idxBuf = (uint8_t*)_idxSprite.getBuffer();
+  Mode frameMode = currentMode;        // a finished fade-out switches currentMode
+  bool palCycled = paletteCycled(frameMode);
+  bool striped = stripRendered(frameMode);  // rows render during the push
+  bool geomDue = palGeomAge == 0;      // palette-cycled: re-render indices
+  palGeomAge = (palGeomAge + 1) % PALCYCLE_GEOM_FRAMES;
+  uint8_t pal[256];                    // output palette (plasma, moiré)
+
+  uint32_t renderStartUs = micros();
   switch (currentMode) {
-    case MODE_PLASMA:    renderPlasma(buf);    break;
+    case MODE_PLASMA:
+      plasmaPalette(pal);
+      if (palCycled && !geomDue) break;
+      if (striped) plasmaFrame();
+      else if (!palCycled) renderPlasma(buf, pal);
+      else renderPlasma(idxBuf, identityLUT);
+      break;
     case MODE_PARTICLES: renderParticles(buf); break;
-    case MODE_MOIRE:     renderMoire(buf);     break;
+    case MODE_MOIRE:
+      moirePalette(pal);
+      if (palCycled && !geomDue) break;
+      if (striped) moireFrame();
+      else if (!palCycled) renderMoire(buf, pal);
+      else renderMoire(idxBuf, identityLUT);
+      break;
     case MODE_CELLULAR:  renderCellular(buf);  break;
+    case MODE_REACTION:  renderReaction(buf);  break;
+    case MODE_TUNNEL:
+      if (striped) tunnelFrame();
+      else renderTunnel(buf);
+      break;
+    case MODE_METABALLS: renderMetaballs(buf); break;
+    case MODE_VORONOI:   renderVoronoi(buf);   break;
+    case MODE_SDF:       renderSdf(buf);       break;
     default: break;
   }
+  uint32_t renderUs = micros() - renderStartUs;
 
   // --- Handle transition fade ---
+  uint8_t bright = 255;
   if (transitioning) {
     uint32_t elapsed = now - transStart;
     if (transPhase == 0) {
       // Fade out
       if (elapsed >= TRANS_DURATION) {
-        applyBrightness(buf, 0);
+#if ENABLE_PERF_LOG
+        Serial.printf("mode %d: render %lu us\n", (int)currentMode, (unsigned long)perfRenderUs);
+        if (currentMode == MODE_SDF) sdfReport();
+        if (paletteCycled(currentMode)) palCycleReport();
+        char gov[192];
+        govFormat(gov, sizeof(gov));
+        Serial.printf("gov: mode %d: %s\n", (int)currentMode, gov);
+        perfRenderUs = 0;
+#endif
+        bright = 0;
         transPhase = 1;
         transStart = now;
-        activateNextMode();
+        activateNextMode(buf);
       } else {
-        uint8_t bright = 255 - (uint8_t)((elapsed * 255) / TRANS_DURATION);
-        applyBrightness(buf, bright);
+        bright = 255 - (uint8_t)((elapsed * 255) / TRANS_DURATION);
+        if (!prewarmDone) prewarmDone = prewarmSlice(nextMode, prewarmPos);
       }
     } else {
       // Fade in
       if (elapsed >= TRANS_DURATION) {
         transitioning = false;
+#if ENABLE_PERF_LOG
+        Serial.printf("transition -> mode %d: worst frame %lu us, steady %lu us\n",
+                      (int)currentMode, (unsigned long)perfWorstUs, (unsigned long)perfSteadyUs);
+        perfWorstUs = 0;
+#endif
       } else {
-        uint8_t bright = (uint8_t)((elapsed * 255) / TRANS_DURATION);
-        applyBrightness(buf, bright);
+        bright = (uint8_t)((elapsed * 255) / TRANS_DURATION);
       }
     }
   }
 
   // --- Push to display ---
-  if (currentMode == MODE_PARTICLES || currentMode == MODE_CELLULAR) {
-    diffDraw(&_sprites[_flip], &_sprites[_flip ^ 1]);
+  uint32_t presentStartUs = micros();
+  if (striped) {
+    // Rows render strip by strip while the previous strip is on the bus
+    uint32_t stripUs = pushStrips(frameMode, pal, bright, palCycled ? idxBuf : nullptr, geomDue);
+    renderUs += stripUs;
+    presentStartUs += stripUs;
+  } else if (palCycled) {
+    // Palette-only frame unless geomDue; brightness goes into the palette
+    pushPaletteFrame(pal, bright);
   } else {
-    sp.pushSprite(&lcd, 0, 0);
+    if (bright < 255) applyBrightness(buf, bright);
+    if (currentMode == MODE_PARTICLES || currentMode == MODE_CELLULAR ||
+        currentMode == MODE_REACTION || currentMode == MODE_VORONOI) {
+      diffDraw(&_sprites[_flip], &_sprites[_flip ^ 1]);
+    } else if (currentMode == MODE_METABALLS) {
+      pushMetaTiles(sp);
+    } else {
+      sp.pushSprite(&lcd, 0, 0);
+    }
+    _flip ^= 1;
+  }
+  if (!transitioning) govFrame(renderUs, micros() - presentStartUs);
+#if ENABLE_PERF_LOG
+  if (palCycled && frameMode == currentMode) {
+    uint32_t& ema = geomDue ? palGeomUs : palOnlyUs;
+    uint32_t frameUs = micros() - renderStartUs;
+    ema = ema ? (ema * 7 + frameUs) >> 3 : frameUs;
+  }
+  // Strip modes render during the push, so render time is final only here
+  if (frameMode == currentMode) {
+    perfRenderUs = perfRenderUs ? (perfRenderUs * 15 + renderUs) >> 4 : renderUs;
+  }
+#endif
+#if ENABLE_POWER_TRACE
+  if (now - traceLastMs >= POWER_TRACE_MS) {
+    traceLastMs = now;
+    char line[96];
+    govTrace(line, sizeof(line), now, (int)currentMode, M5.Power.getBatteryCurrent());
+    Serial.println(line);
   }
-  _flip ^= 1;
+#endif
 
   // --- NeoPixels (every 3rd frame) ---
   if (frameCount % 3 == 0) {
-    updateNeoPixels(buf);
+    if (striped)        updateNeoPixels(_strips.kept);
+    else if (palCycled) updateNeoPixels(idxBuf + SCR_H / 2 * SCR_W, pal);
+    else                updateNeoPixels(buf + SCR_H / 2 * SCR_W);
   }
 }
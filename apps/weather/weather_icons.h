@@ -1,5 +1,6 @@
 #pragma once
 #include <M5GFX.h>
+#include "fastmath.h"
 
 // Color palette
 #define IC_SUN      0xFEA0  // warm yellow
@@ -17,11 +18,11 @@ static void drawSun(M5GFX& gfx, int cx, int cy, int r) {
     gfx.fillCircle(cx, cy, r, IC_SUN);
     // 8 rays
     for (int i = 0; i < 8; i++) {
-        float a = i * PI / 4.0f;
-        int x1 = cx + cos(a) * (r + 2);
-        int y1 = cy + sin(a) * (r + 2);
-        int x2 = cx + cos(a) * (r + r / 2 + 2);
-        int y2 = cy + sin(a) * (r + r / 2 + 2);
+        uint16_t a = i * (FM_TURN / 8);
+        int x1 = cx + ((fmCos(a) * (r + 2)) >> 15);
+        int y1 = cy + ((fmSin(a) * (r + 2)) >> 15);
+        int x2 = cx + ((fmCos(a) * (r + r / 2 + 2)) >> 15);
+        int y2 = cy + ((fmSin(a) * (r + r / 2 + 2)) >> 15);
         gfx.drawLine(x1, y1, x2, y2, IC_SUN);
     }
 }
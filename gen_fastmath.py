@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Generate src/fastmath_tables.h, the constant tables behind src/fastmath.h.
+
+Tables are emitted as static const arrays, so they live in flash and cost
+no RAM or boot time:
+  fmSinQ15   quarter-wave sine, Q15, 256 steps per quadrant (+2 guard)
+  fmRecipQ15 reciprocal seeds for 1/x, x in [1, 2), Q15
+  fmHue332   full-saturation, full-value hue wheel in RGB332
+"""
+
+import math
+from pathlib import Path
+
+
+def rgb332(r, g, b):
+    return (r & 0xE0) | ((g >> 3) & 0x1C) | (b >> 6)
+
+
+def hue_to_rgb332(h):
+    # Same math as the float hsvToRgb332 it replaces (s = v = 1)
+    c = 1.0
+    x = c * (1.0 - abs(math.fmod(h / 60.0, 2.0) - 1.0))
+    if h < 60:
+        rf, gf, bf = c, x, 0
+    elif h < 120:
+        rf, gf, bf = x, c, 0
+    elif h < 180:
+        rf, gf, bf = 0, c, x
+    elif h < 240:
+        rf, gf, bf = 0, x, c
+    elif h < 300:
+        rf, gf, bf = x, 0, c
+    else:
+        rf, gf, bf = c, 0, x
+    return rgb332(int(rf * 255), int(gf * 255), int(bf * 255))
+
+
+def emit(lines, ctype, name, values, fmt, per_line=16):
+    lines.append(f"static const {ctype} {name}[{len(values)}] = {{")
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        comma = "," if i + per_line < len(values) else ""
+        lines.append("  " + ", ".join(fmt(v) for v in chunk) + comma)
+    lines.append("};")
+    lines.append("")
+
+
+def main():
+    out_path = Path(__file__).resolve().parent / "src" / "fastmath_tables.h"
+
+    sin_q15 = [round(32767 * math.sin(i * math.pi / 512)) for i in range(257)]
+    sin_q15.append(sin_q15[-1])  # guard so interpolation never branches
+
+    # Seed at the midpoint of each 1/256 step, so the error is centered
+    recip_q15 = [round(32768 / (1 + (i + 0.5) / 256)) for i in range(256)]
+
+    hue332 = [hue_to_rgb332(i * 360.0 / 256) for i in range(256)]
+
+    lines = [
+        "#pragma once",
+        "// Auto-generated by gen_fastmath.py -- do not edit",
+        "// Constant tables for fastmath.h (flash, no RAM copy)",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    emit(lines, "int16_t", "fmSinQ15", sin_q15, lambda v: f"{v:5d}", 12)
+    emit(lines, "uint16_t", "fmRecipQ15", recip_q15, lambda v: f"{v:5d}", 12)
+    emit(lines, "uint8_t", "fmHue332", hue332, lambda v: f"0x{v:02X}")
+
+    out_path.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Generated {out_path}")
+    print(f"Tables: {len(sin_q15) * 2 + len(recip_q15) * 2 + len(hue332)} bytes flash")
+
+
+if __name__ == "__main__":
+    main()
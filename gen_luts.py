@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""Generate src/luts.h, the lookup tables the apps used to build in setup().
+
+Everything here is emitted as static const data, so it lives in flash
+(rodata) instead of being computed at boot and copied into RAM:
+  fadeLUT       RGB332 dim to 216/256 (trails; screensavers and genart)
+  sinLUT        sin * 127 + 128 over 256 steps (genart plasma)
+  caReact       S-curve reaction for the genart cellular automaton
+  identityLUT   i -> i, for rendering raw palette indices
+  metaFalloff   metaball field (1 - d^2/R^2)^2 * 255, indexed by d^2/R^2 * 256
+  artPalettes   the six genart HSV palettes in RGB332
+  firePalette   black -> red -> orange -> yellow -> white (screensaver fire)
+
+The float math mirrors the C code it replaced step by step, rounding to
+float32 after every operation, so the tables match what the device used
+to compute at boot.
+"""
+
+import math
+import struct
+from pathlib import Path
+
+
+def f32(x):
+    return struct.unpack("f", struct.pack("f", x))[0]
+
+
+def sinf(x):
+    return f32(math.sin(f32(x)))
+
+
+def cosf(x):
+    return f32(math.cos(f32(x)))
+
+
+def rgb332(r, g, b):
+    return (r & 0xE0) | ((g >> 3) & 0x1C) | (b >> 6)
+
+
+def rgb332_dim(c, factor):
+    r = c & 0xE0
+    g = (c & 0x1C) << 3
+    b = (c & 0x03) << 6
+    r = (r * factor) >> 8
+    g = (g * factor) >> 8
+    b = (b * factor) >> 8
+    return (r & 0xE0) | ((g >> 3) & 0x1C) | (b >> 6)
+
+
+def sin_lut():
+    # (uint8_t)(127.0f * sinf(i * M_PI * 2.0f / 256.0f) + 128)
+    return [int(f32(f32(127.0 * sinf(i * math.pi * 2.0 / 256.0)) + 128)) & 0xFF
+            for i in range(256)]
+
+
+def ca_react():
+    out = []
+    for v in range(256):
+        v = v + ((v - 128) >> 2) if v > 128 else v - ((128 - v) >> 2)
+        out.append(max(0, min(255, v)))
+    return out
+
+
+# base hue, hue range, saturation range, value range
+PALETTES = [
+    ("ember",  0,   40,  0.7, 1.0, 0.4, 1.0),
+    ("ocean",  160, 60,  0.5, 0.9, 0.3, 1.0),
+    ("aurora", 80,  120, 0.6, 1.0, 0.3, 1.0),
+    ("sunset", 10,  50,  0.7, 1.0, 0.5, 1.0),
+    ("neon",   200, 160, 0.8, 1.0, 0.5, 1.0),
+    ("moss",   100, 40,  0.4, 0.8, 0.3, 0.9),
+]
+
+
+def art_palette(h_base, h_range, s_min, s_max, v_min, v_max):
+    h_base, h_range = f32(h_base), f32(h_range)
+    s_min, s_max, v_min, v_max = f32(s_min), f32(s_max), f32(v_min), f32(v_max)
+    pal = []
+    for i in range(256):
+        t = f32(i / 255.0)
+        # Sine-based variation for smooth cycling
+        h = f32(math.fmod(f32(h_base + f32(h_range * sinf(t * math.pi * 2.0))), 360.0))
+        if h < 0:
+            h = f32(h + 360.0)
+        s = f32(s_min + f32(f32(s_max - s_min) * f32(0.5 + f32(0.5 * sinf(t * math.pi * 3.0)))))
+        v = f32(v_min + f32(f32(v_max - v_min) * f32(0.5 + f32(0.5 * cosf(t * math.pi * 2.5)))))
+
+        c = f32(v * s)
+        x = f32(c * f32(1.0 - abs(f32(math.fmod(f32(h / 60.0), 2.0) - 1.0))))
+        m = f32(v - c)
+        if h < 60:
+            rf, gf, bf = c, x, 0.0
+        elif h < 120:
+            rf, gf, bf = x, c, 0.0
+        elif h < 180:
+            rf, gf, bf = 0.0, c, x
+        elif h < 240:
+            rf, gf, bf = 0.0, x, c
+        elif h < 300:
+            rf, gf, bf = x, 0.0, c
+        else:
+            rf, gf, bf = c, 0.0, x
+        r8 = int(f32(f32(rf + m) * 255)) & 0xFF
+        g8 = int(f32(f32(gf + m) * 255)) & 0xFF
+        b8 = int(f32(f32(bf + m) * 255)) & 0xFF
+        pal.append(rgb332(r8, g8, b8))
+    return pal
+
+
+# position (0..1), RGB
+FIRE_STOPS = [
+    (0.00, (0, 0, 0)),
+    (0.18, (80, 0, 0)),
+    (0.40, (200, 24, 0)),
+    (0.60, (255, 110, 0)),
+    (0.80, (255, 210, 32)),
+    (1.00, (255, 255, 255)),
+]
+
+
+def fire_palette():
+    pal = []
+    for i in range(256):
+        t = i / 255
+        for (t0, c0), (t1, c1) in zip(FIRE_STOPS, FIRE_STOPS[1:]):
+            if t <= t1:
+                f = (t - t0) / (t1 - t0)
+                r, g, b = (round(a + (b - a) * f) for a, b in zip(c0, c1))
+                break
+        pal.append(rgb332(r, g, b))
+    return pal
+
+
+def emit(lines, name, values, comment=None, per_line=16, indent="  "):
+    if comment:
+        lines.append(f"// {comment}")
+    lines.append(f"static const uint8_t {name}[256] = {{")
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        comma = "," if i + per_line < len(values) else ""
+        lines.append(indent + ", ".join(f"0x{v:02X}" for v in chunk) + comma)
+    lines.append("};")
+    lines.append("")
+
+
+def main():
+    out_path = Path(__file__).resolve().parent / "src" / "luts.h"
+
+    lines = [
+        "#pragma once",
+        "// Auto-generated by gen_luts.py -- do not edit",
+        "// Lookup tables in flash; nothing here is built at boot",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+    emit(lines, "fadeLUT", [rgb332_dim(i, 216) for i in range(256)], "RGB332 dim to ~85% (216/256)")
+    emit(lines, "sinLUT", sin_lut(), "sin*127+128")
+    emit(lines, "caReact", ca_react(), "CA reaction: nonlinear S-curve, pushes away from middle")
+    emit(lines, "identityLUT", list(range(256)), "Raw palette indices")
+    emit(lines, "metaFalloff", [round(255 * (1 - i / 256) ** 2) for i in range(256)],
+         "Metaball falloff (1 - t)^2, t = d^2 / R^2 in 1/256 steps; zero at t = 1")
+
+    emit(lines, "firePalette", fire_palette(), "Fire: black -> red -> orange -> yellow -> white (RGB332)")
+
+    lines.append(f"#define NUM_ART_PALETTES {len(PALETTES)}")
+    lines.append("")
+    lines.append("// Genart palettes (RGB332): " + ", ".join(p[0] for p in PALETTES))
+    lines.append(f"static const uint8_t artPalettes[{len(PALETTES)}][256] = {{")
+    for n, p in enumerate(PALETTES):
+        pal = art_palette(*p[1:])
+        lines.append(f"  {{ // {p[0]}")
+        for i in range(0, 256, 16):
+            comma = "," if i + 16 < 256 else ""
+            lines.append("    " + ", ".join(f"0x{v:02X}" for v in pal[i:i + 16]) + comma)
+        lines.append("  }" + ("," if n + 1 < len(PALETTES) else ""))
+    lines.append("};")
+    lines.append("")
+
+    out_path.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Generated {out_path}")
+    print(f"Tables: {256 * 6 + 256 * len(PALETTES)} bytes flash")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Generate src/maze_textures.h, the wall texture atlas for the 3D Maze mode.
+
+Textures are 64x64 RGB332, drawn procedurally with a fixed seed:
+  0 brick   red-brown bricks in running bond, gray mortar
+  1 stone   irregular gray blocks (outer walls)
+  2 wood    vertical planks with grain
+  3 exit    checkered flag (walls next to the goal)
+
+Each texture is stored column-major (texel (x, y) at x * 64 + y), since
+the raycaster draws one screen column from one texture column. Entries
+MAZE_TEXTURES and up are the same textures dimmed, for walls hit on
+their y side.
+"""
+
+import random
+from pathlib import Path
+
+SIZE = 64
+DIM = 170  # y-side shade, /256
+
+
+def rgb332(r, g, b):
+    r, g, b = (max(0, min(255, int(v))) for v in (r, g, b))
+    return (r & 0xE0) | ((g >> 3) & 0x1C) | (b >> 6)
+
+
+def rgb332_dim(c, factor):
+    r = c & 0xE0
+    g = (c & 0x1C) << 3
+    b = (c & 0x03) << 6
+    return rgb332((r * factor) >> 8, (g * factor) >> 8, (b * factor) >> 8)
+
+
+def brick(rng):
+    tex = [[0] * SIZE for _ in range(SIZE)]
+    shades = {}
+    for y in range(SIZE):
+        row = y // 8
+        for x in range(SIZE):
+            bx = (x + (8 if row % 2 else 0)) % SIZE
+            if y % 8 == 7 or bx % 16 == 15:
+                n = rng.randint(-12, 12)
+                tex[x][y] = rgb332(150 + n, 150 + n, 140 + n)
+                continue
+            key = (row, bx // 16)
+            if key not in shades:
+                shades[key] = rng.randint(-30, 30)
+            s = shades[key] + rng.randint(-18, 18)
+            tex[x][y] = rgb332(170 + s, 60 + s // 2, 40 + s // 3)
+    return tex
+
+
+def stone(rng):
+    tex = [[0] * SIZE for _ in range(SIZE)]
+    rows = [0, 14, 30, 46, 64]
+    for r in range(len(rows) - 1):
+        y0, y1 = rows[r], rows[r + 1]
+        cuts = [0]
+        while cuts[-1] < SIZE:
+            cuts.append(cuts[-1] + rng.randint(14, 26))
+        cuts[-1] = SIZE
+        offset = rng.randint(0, 12)
+        for i in range(len(cuts) - 1):
+            base = rng.randint(105, 150)
+            for y in range(y0, y1):
+                for xx in range(cuts[i], cuts[i + 1]):
+                    x = (xx + offset) % SIZE
+                    if y == y1 - 1 or xx == cuts[i + 1] - 1:
+                        v = 60 + rng.randint(-8, 8)
+                    elif y == y0 or xx == cuts[i]:
+                        v = base + 40
+                    else:
+                        v = base + rng.randint(-14, 14)
+                    tex[x][y] = rgb332(v, v, v + 10)
+    return tex
+
+
+def wood(rng):
+    tex = [[0] * SIZE for _ in range(SIZE)]
+    for p in range(4):
+        base = rng.randint(-20, 20)
+        phase = rng.random() * 6.0
+        for x in range(p * 16, p * 16 + 16):
+            for y in range(SIZE):
+                if x % 16 == 15:
+                    tex[x][y] = rgb332(50, 30, 10)
+                    continue
+                grain = ((x * 3 + int(4 * abs(((y / 9.0 + phase) % 2) - 1))) % 5 == 0)
+                v = base + rng.randint(-8, 8) - (30 if grain else 0)
+                tex[x][y] = rgb332(150 + v, 95 + v, 45 + v // 2)
+    return tex
+
+
+def exit_flag(rng):
+    tex = [[0] * SIZE for _ in range(SIZE)]
+    for x in range(SIZE):
+        for y in range(SIZE):
+            border = x < 3 or y < 3 or x >= SIZE - 3 or y >= SIZE - 3
+            if border:
+                tex[x][y] = rgb332(40, 200, 40)
+            elif (x // 8 + y // 8) % 2:
+                tex[x][y] = rgb332(255, 255, 255)
+            else:
+                tex[x][y] = rgb332(0, 0, 0)
+    return tex
+
+
+TEXTURES = [("brick", brick), ("stone", stone), ("wood", wood), ("exit", exit_flag)]
+
+
+def main():
+    out_path = Path(__file__).resolve().parent / "src" / "maze_textures.h"
+    rng = random.Random(1987)
+
+    flat = []
+    for _, make in TEXTURES:
+        tex = make(rng)
+        flat.append([tex[x][y] for x in range(SIZE) for y in range(SIZE)])
+    flat += [[rgb332_dim(c, DIM) for c in t] for t in flat[:len(TEXTURES)]]
+
+    lines = [
+        "#pragma once",
+        "// Auto-generated by gen_maze_textures.py -- do not edit",
+        "// 3D Maze wall atlas: RGB332, column-major, then the same set dimmed",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define MAZE_TEX {SIZE}",
+        f"#define MAZE_TEXTURES {len(TEXTURES)}  // " + ", ".join(t[0] for t in TEXTURES),
+        "",
+        f"static const uint8_t mazeAtlas[{len(flat)}][MAZE_TEX * MAZE_TEX] = {{",
+    ]
+    for n, tex in enumerate(flat):
+        name = TEXTURES[n % len(TEXTURES)][0] + (" (dim)" if n >= len(TEXTURES) else "")
+        lines.append(f"  {{ // {name}")
+        for i in range(0, len(tex), 16):
+            comma = "," if i + 16 < len(tex) else ""
+            lines.append("    " + ", ".join(f"0x{v:02X}" for v in tex[i:i + 16]) + comma)
+        lines.append("  }" + ("," if n + 1 < len(flat) else ""))
+    lines.append("};")
+    lines.append("")
+
+    out_path.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Generated {out_path}")
+    print(f"Atlas: {len(flat) * SIZE * SIZE} bytes flash")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Estimate what per-mode CPU clock scaling saves, from a recorded trace.
+
+Build an app with ENABLE_POWER_TRACE set to 1 and record its serial
+output (e.g. pio device monitor | tee trace.log). Every second it prints
+
+  trace,<ms>,<mode>,<cpu MHz>,<render us>,<present us>,<current mA>
+
+Usage:
+  python power_trace.py trace.log
+  python power_trace.py trace.log 240=95,160=70,80=48
+
+For every mode the report shows the time spent at each clock, with its
+frame times and current. Each mode visit starts at 240 MHz before the
+governor steps the clock down, so the 240 MHz samples give the
+baseline. The estimated saving is the charge the trace would have used
+at 240 MHz throughout, minus the charge it did use.
+
+The current column is M5.Power.getBatteryCurrent(). A PMIC that can't
+measure it reports 0; in that case pass a per-clock model (mA at each
+MHz, from a USB meter or your own bench numbers) as the second argument.
+"""
+
+import sys
+from collections import defaultdict
+
+
+def parse(path):
+    samples = []
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            i = line.find("trace,")
+            if i < 0:
+                continue
+            fields = line[i:].strip().split(",")
+            if len(fields) != 7:
+                continue
+            try:
+                ms, mode, mhz, render, present, ma = (int(v) for v in fields[1:])
+            except ValueError:
+                continue
+            samples.append((ms, mode, mhz, render, present, abs(ma)))
+    return samples
+
+
+def parse_model(arg):
+    model = {}
+    for part in arg.split(","):
+        mhz, ma = part.split("=")
+        model[int(mhz)] = float(ma)
+    return model
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print(__doc__)
+        sys.exit(1)
+    samples = parse(sys.argv[1])
+    model = parse_model(sys.argv[2]) if len(sys.argv) == 3 else None
+    if len(samples) < 2:
+        print("No trace lines found")
+        sys.exit(1)
+
+    # Time a sample stands for: the gap to the next one, capped so a
+    # pause in the log doesn't count as hours at one clock
+    gaps = sorted(b[0] - a[0] for a, b in zip(samples, samples[1:]) if b[0] > a[0])
+    typical = gaps[len(gaps) // 2] if gaps else 1000
+    weighted = []
+    for a, b in zip(samples, samples[1:] + [None]):
+        dt = typical if b is None or b[0] <= a[0] else min(b[0] - a[0], 2 * typical)
+        weighted.append((dt / 1000.0,) + a[1:])
+
+    measured = any(s[5] for s in weighted)
+    if not measured and not model:
+        print("Trace has no current readings; pass a model like 240=95,160=70,80=48 for savings")
+
+    # mode -> mhz -> [seconds, render*s, present*s, mA*s, seconds with mA]
+    stats = defaultdict(lambda: defaultdict(lambda: [0.0, 0.0, 0.0, 0.0, 0.0]))
+    for dt, mode, mhz, render, present, ma in weighted:
+        st = stats[mode][mhz]
+        st[0] += dt
+        st[1] += render * dt
+        st[2] += present * dt
+        if ma:
+            st[3] += ma * dt
+            st[4] += dt
+
+    def current(mode, mhz):
+        st = stats[mode].get(mhz)
+        if measured and st and st[4]:
+            return st[3] / st[4]
+        if model and mhz in model:
+            return model[mhz]
+        return None
+
+    total_used = total_base = 0.0
+    print(f"{'mode':>4} {'MHz':>4} {'time s':>8} {'share':>6} {'render us':>10} {'present us':>11} {'mA':>7}")
+    for mode in sorted(stats):
+        mode_time = sum(st[0] for st in stats[mode].values())
+        base = current(mode, 240)
+        for mhz in sorted(stats[mode], reverse=True):
+            st = stats[mode][mhz]
+            ma = current(mode, mhz)
+            print(f"{mode:>4} {mhz:>4} {st[0]:>8.0f} {st[0] / mode_time:>6.0%} {st[1] / st[0]:>10.0f} "
+                  f"{st[2] / st[0]:>11.0f} {'-' if ma is None else f'{ma:.1f}':>7}")
+            if base is not None and ma is not None:
+                total_used += ma * st[0]
+                total_base += base * st[0]
+
+    if total_base:
+        saved = total_base - total_used
+        print(f"\nCharge: {total_used / 3600:.1f} mAh used, {total_base / 3600:.1f} mAh at 240 MHz throughout")
+        print(f"Saved: {saved / 3600:.1f} mAh ({saved / total_base:.0%})")
+
+
+if __name__ == "__main__":
+    main()
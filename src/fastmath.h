@@ -0,0 +1,77 @@
+#pragma once
+// Fixed-point fast math
+// Table-driven replacements for the libm calls in per-frame paths.
+// Angles are 16-bit binary angles: 65536 = one full turn, so wrapping
+// is free and a uint16_t never needs fmod. Tables come from
+// gen_fastmath.py and live in flash (fastmath_tables.h).
+//
+// Error bounds, asserted against libm by test/fastmath_test.cpp:
+//   fmSin/fmCos   |err| <= 2 LSB Q15   (~6e-5)
+//   fmAtan2       |err| <= 18 units    (~0.1 degrees)
+//   fmRecip       |err| <= 2^-18 relative + 1
+//   fmIsqrt       exact floor(sqrt(n))
+//   fmHue332      identical to the float HSV conversion at s = v = 1
+
+#include <stdint.h>
+#include "fastmath_tables.h"
+
+#define FM_ONE        32767      // 1.0 in Q15 (sin/cos results)
+#define FM_TURN       65536      // binary angle units per turn
+#define FM_DEG_TO_ANG 182.04444f // 65536 / 360
+
+// Radians (any magnitude) to a binary angle. Whole turns are dropped
+// first so large arguments (timeS * freq after days of uptime) can't
+// overflow the integer conversion.
+static inline uint16_t fmAngle(float rad) {
+  float turns = rad * (1.0f / 6.2831853f);
+  turns -= (float)(int32_t)turns;
+  return (uint16_t)(int32_t)(turns * FM_TURN);
+}
+
+// sin(a) in Q15, linear interpolation between quarter-wave entries
+static inline int16_t fmSin(uint16_t a) {
+  uint32_t p = a & 0x3FFF;              // position within the quadrant
+  if (a & 0x4000) p = 0x4000 - p;       // 2nd/4th quadrant: mirror
+  uint32_t i = p >> 6, f = p & 63;
+  int32_t v = fmSinQ15[i] + (((fmSinQ15[i + 1] - fmSinQ15[i]) * (int32_t)f) >> 6);
+  return (a & 0x8000) ? -v : v;
+}
+
+static inline int16_t fmCos(uint16_t a) { return fmSin(a + 0x4000); }
+
+// atan2(y, x) as a binary angle (0 = +x, 16384 = +y). Octant reduction
+// plus atan(t) ~ t*pi/4 + t*(1-t)*(0.2447 + 0.0663t) on t in [0, 1].
+static inline uint16_t fmAtan2(int32_t y, int32_t x) {
+  if (x == 0 && y == 0) return 0;
+  uint32_t ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+  uint32_t mn = ax < ay ? ax : ay, mx = ax < ay ? ay : ax;
+  uint32_t t = (uint32_t)(((uint64_t)mn << 15) / mx);      // Q15, 0..1
+  uint32_t a = (t * 8192 + ((t * (32768 - t) >> 15) * (2552 + ((691 * t) >> 15)))) >> 15;
+  if (ay > ax) a = 16384 - a;
+  if (x < 0) a = 32768 - a;
+  if (y < 0) a = 65536 - a;
+  return (uint16_t)a;
+}
+
+// 2^32 / d for d >= 2 (d < 2 saturates): 8-bit table seed + one Newton step
+static inline uint32_t fmRecip(uint32_t d) {
+  if (d < 2) return 0xFFFFFFFFu;
+  int n = __builtin_clz(d);
+  uint32_t m = d << n;                                     // [2^31, 2^32)
+  uint32_t y = (uint32_t)fmRecipQ15[(m >> 23) & 0xFF] << 15;  // ~2^31 / x, Q30
+  uint32_t xy = (uint32_t)(((uint64_t)m * y) >> 32);        // ~1.0 in Q29
+  y = (uint32_t)(((uint64_t)y * ((1u << 30) - xy)) >> 28);  // y * (2 - xy)
+  return n >= 30 ? y << (n - 30) : y >> (30 - n);
+}
+
+// floor(sqrt(n)), bit by bit
+static inline uint32_t fmIsqrt(uint32_t n) {
+  uint32_t r = 0, bit = 1u << 30;
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= r + bit) { n -= r + bit; r = (r >> 1) + bit; }
+    else r >>= 1;
+    bit >>= 2;
+  }
+  return r;
+}
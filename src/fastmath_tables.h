@@ -0,0 +1,74 @@
+#pragma once
+// Auto-generated by gen_fastmath.py -- do not edit
+// Constant tables for fastmath.h (flash, no RAM copy)
+
+#include <stdint.h>
+
+static const int16_t fmSinQ15[258] = {
+      0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+   2410,  2611,  2811,  3012,  3212,  3412,  3612,  3811,  4011,  4210,  4410,  4609,
+   4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6786,  6983,
+   7179,  7375,  7571,  7767,  7962,  8157,  8351,  8545,  8739,  8933,  9126,  9319,
+   9512,  9704,  9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+  14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623, 15800, 15976,
+  16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+  18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000,
+  20159, 20317, 20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+  22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+  23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+  25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674,
+  26790, 26905, 27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+  28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+  29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+  30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050,
+  31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+  31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250,
+  32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+  32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+  32757, 32761, 32765, 32766, 32767, 32767
+};
+
+static const uint16_t fmRecipQ15[256] = {
+  32704, 32577, 32451, 32326, 32202, 32079, 31957, 31835, 31715, 31596, 31477, 31359,
+  31242, 31127, 31011, 30897, 30784, 30671, 30560, 30449, 30339, 30229, 30121, 30013,
+  29906, 29800, 29694, 29589, 29485, 29382, 29280, 29178, 29077, 28976, 28876, 28777,
+  28679, 28581, 28484, 28388, 28292, 28197, 28103, 28009, 27916, 27823, 27731, 27640,
+  27549, 27459, 27369, 27280, 27192, 27104, 27016, 26930, 26844, 26758, 26673, 26588,
+  26504, 26421, 26338, 26255, 26174, 26092, 26011, 25931, 25851, 25771, 25693, 25614,
+  25536, 25459, 25382, 25305, 25229, 25153, 25078, 25003, 24929, 24855, 24782, 24709,
+  24636, 24564, 24492, 24421, 24350, 24280, 24210, 24140, 24071, 24002, 23933, 23865,
+  23797, 23730, 23663, 23597, 23530, 23465, 23399, 23334, 23269, 23205, 23141, 23077,
+  23014, 22951, 22888, 22826, 22764, 22703, 22641, 22580, 22520, 22459, 22399, 22340,
+  22280, 22221, 22163, 22104, 22046, 21988, 21931, 21874, 21817, 21760, 21704, 21648,
+  21592, 21537, 21482, 21427, 21372, 21318, 21264, 21210, 21157, 21103, 21050, 20998,
+  20945, 20893, 20841, 20790, 20738, 20687, 20636, 20586, 20535, 20485, 20435, 20385,
+  20336, 20287, 20238, 20189, 20141, 20092, 20044, 19997, 19949, 19902, 19855, 19808,
+  19761, 19715, 19668, 19622, 19577, 19531, 19486, 19441, 19396, 19351, 19306, 19262,
+  19218, 19174, 19130, 19087, 19043, 19000, 18957, 18915, 18872, 18830, 18787, 18745,
+  18704, 18662, 18621, 18579, 18538, 18497, 18457, 18416, 18376, 18336, 18296, 18256,
+  18216, 18177, 18138, 18098, 18059, 18021, 17982, 17944, 17905, 17867, 17829, 17791,
+  17754, 17716, 17679, 17642, 17605, 17568, 17531, 17494, 17458, 17422, 17386, 17350,
+  17314, 17278, 17243, 17207, 17172, 17137, 17102, 17067, 17033, 16998, 16964, 16930,
+  16895, 16862, 16828, 16794, 16760, 16727, 16694, 16661, 16628, 16595, 16562, 16529,
+  16497, 16464, 16432, 16400
+};
+
+static const uint8_t fmHue332[256] = {
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+  0xE8, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+  0xF4, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+  0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+  0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x17, 0x17, 0x17, 0x17, 0x17,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x23, 0x23, 0x23, 0x23, 0x23, 0x43, 0x43, 0x43, 0x43, 0x43, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x83, 0x83, 0x83, 0x83, 0x83, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0
+};
@@ -0,0 +1,94 @@
+#pragma once
+// Fixed-point scalars and 2D vectors
+// Fixed<F, T> stores value * 2^F in the integer T. Plain operators wrap
+// like the underlying integer (two's complement, no UB); sat*() variants
+// clamp to T's range instead. Everything is constexpr, so constants such
+// as Px::fromFloat(0.6f) fold at compile time and the per-frame update
+// loops stay integer-only.
+//
+// Px / PxVec (Q9.6 in 16 bits: ±511 px at 1/64 px) cover on-screen and
+// just-off-screen positions and velocities — the same 1/64 px step the
+// genart particles use.
+
+#include <stdint.h>
+#include <limits>
+#include <type_traits>
+
+template <int F, typename T = int32_t>
+struct Fixed {
+  typedef typename std::make_unsigned<T>::type U;
+  typedef typename std::conditional<sizeof(T) <= 2, int32_t, int64_t>::type Wide;
+  // U widened past int, so a 16-bit product can't promote to signed int
+  // and overflow
+  typedef typename std::conditional<sizeof(T) <= 2, uint32_t, U>::type UMul;
+  static const T ONE = (T)1 << F;
+
+  T raw;
+
+  constexpr Fixed() : raw(0) {}
+
+  static constexpr Fixed fromRaw(T r) { return Fixed(r, 0); }
+  static constexpr Fixed fromInt(int v) { return fromRaw((T)(v * ONE)); }
+  static constexpr Fixed fromFloat(float v) {
+    return fromRaw((T)(v * ONE + (v < 0 ? -0.5f : 0.5f)));
+  }
+
+  constexpr int toInt() const { return raw >> F; }  // floor
+  constexpr int roundInt() const { return (raw + (ONE >> 1)) >> F; }
+  constexpr float toFloat() const { return raw * (1.0f / ONE); }
+
+  // Wrapping
+  constexpr Fixed operator+(Fixed o) const { return fromRaw((T)(U)((U)raw + (U)o.raw)); }
+  constexpr Fixed operator-(Fixed o) const { return fromRaw((T)(U)((U)raw - (U)o.raw)); }
+  constexpr Fixed operator-() const { return fromRaw((T)(U)(0 - (U)raw)); }
+  constexpr Fixed operator*(Fixed o) const { return fromRaw((T)(((Wide)raw * o.raw) >> F)); }
+  constexpr Fixed operator*(int k) const { return fromRaw((T)(U)((UMul)(U)raw * (UMul)(U)k)); }
+  constexpr Fixed operator>>(int s) const { return fromRaw(raw >> s); }
+  Fixed& operator+=(Fixed o) { return *this = *this + o; }
+  Fixed& operator-=(Fixed o) { return *this = *this - o; }
+
+  // Saturating
+  constexpr Fixed satAdd(Fixed o) const { return fromRaw(clamp((Wide)raw + o.raw)); }
+  constexpr Fixed satSub(Fixed o) const { return fromRaw(clamp((Wide)raw - o.raw)); }
+  constexpr Fixed satMul(Fixed o) const { return fromRaw(clamp(((Wide)raw * o.raw) >> F)); }
+
+  constexpr Fixed abs() const { return raw < 0 ? -*this : *this; }
+
+  constexpr bool operator==(Fixed o) const { return raw == o.raw; }
+  constexpr bool operator!=(Fixed o) const { return raw != o.raw; }
+  constexpr bool operator<(Fixed o) const { return raw < o.raw; }
+  constexpr bool operator<=(Fixed o) const { return raw <= o.raw; }
+  constexpr bool operator>(Fixed o) const { return raw > o.raw; }
+  constexpr bool operator>=(Fixed o) const { return raw >= o.raw; }
+
+ private:
+  constexpr Fixed(T r, int) : raw(r) {}
+  static constexpr T clamp(Wide w) {
+    return w > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max()
+         : w < std::numeric_limits<T>::min() ? std::numeric_limits<T>::min()
+         : (T)w;
+  }
+};
+
+template <int F, typename T = int32_t>
+struct FixedVec2 {
+  typedef Fixed<F, T> S;
+  S x, y;
+
+  constexpr FixedVec2() {}
+  constexpr FixedVec2(S x_, S y_) : x(x_), y(y_) {}
+  static constexpr FixedVec2 fromInt(int x, int y) { return FixedVec2(S::fromInt(x), S::fromInt(y)); }
+
+  constexpr FixedVec2 operator+(FixedVec2 o) const { return FixedVec2(x + o.x, y + o.y); }
+  constexpr FixedVec2 operator-(FixedVec2 o) const { return FixedVec2(x - o.x, y - o.y); }
+  constexpr FixedVec2 operator-() const { return FixedVec2(-x, -y); }
+  constexpr FixedVec2 operator*(S k) const { return FixedVec2(x * k, y * k); }
+  FixedVec2& operator+=(FixedVec2 o) { return *this = *this + o; }
+  FixedVec2& operator-=(FixedVec2 o) { return *this = *this - o; }
+
+  constexpr FixedVec2 satAdd(FixedVec2 o) const { return FixedVec2(x.satAdd(o.x), y.satAdd(o.y)); }
+  constexpr S dot(FixedVec2 o) const { return x * o.x + y * o.y; }
+};
+
+typedef Fixed<6, int16_t> Px;        // Q9.6 screen coordinate
+typedef FixedVec2<6, int16_t> PxVec;
@@ -0,0 +1,192 @@
+#pragma once
+// Adaptive quality governor
+// Holds a target frame time per mode by turning the quality knobs the
+// mode declares (object counts, trail lengths, internal resolution).
+// The app times render and present separately and calls govFrame() once
+// per steady frame. Only render time answers to the knobs, so the render
+// budget is the target minus the present time; when the push alone is
+// over target the knobs are left alone.
+//
+// Hysteresis: the render EMA has to exceed the budget to step down and
+// sit below GOV_RAISE_PCT of it to step up, and every change is followed
+// by GOV_HOLD_FRAMES frames without one. A step up that has to be taken
+// back soon after doubles the wait before the next one (up to
+// GOV_MAX_BACKOFF times), so a knob whose next step doesn't fit stops
+// bouncing across the threshold.
+//
+// Knobs are listed most expendable first: a step down takes the first
+// knob above its minimum, a step up the last one below its maximum.
+// Values persist across visits, so a mode comes back at the level it
+// settled on.
+//
+// CPU clock (GOV_CPU_SCALING): quality comes first, power second. Over
+// budget, the clock goes back up before any knob steps down; under
+// budget, knobs step up first, and only a mode with every knob at its
+// maximum (or none) tries the next lower clock, if the render time
+// scaled by the clock ratio still fits. A lower clock that doesn't hold
+// counts as an undone step up, so the back-off re-probes it less and
+// less often. Every visit starts at the top clock; the apps also go back
+// to it for mode transitions, where govFrame() isn't called.
+//
+// Frame times (render + present) also go into a 1 ms histogram per
+// visit, for the percentiles in the serial stats; govTrace() formats a
+// periodic sample for recording power traces.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define GOV_HOLD_FRAMES 30
+#define GOV_RAISE_PCT   75
+#define GOV_MAX_BACKOFF 16
+#define GOV_HIST_MS     64  // 1 ms buckets; the last one collects everything slower
+#define GOV_CLOCK_PCT   85  // a lower clock's predicted render time must fit this % of budget
+#ifndef GOV_CPU_SCALING
+#define GOV_CPU_SCALING 1
+#endif
+
+// ESP32-S3 clocks that keep the 80 MHz APB (SPI, I2C, LEDs) untouched
+static const uint16_t govMhz[] = { 80, 160, 240 };
+#define GOV_CLOCKS (int)(sizeof(govMhz) / sizeof(govMhz[0]))
+
+struct GovKnob {
+  const char* name;
+  int* value;
+  int lo, hi, step;
+};
+
+struct GovMode {
+  const GovKnob* knobs;
+  uint8_t count;
+  uint32_t targetUs;  // frame time to hold
+};
+
+#define GOV_KNOBS(k) k, (uint8_t)(sizeof(k) / sizeof(k[0]))
+
+struct Governor {
+  const GovMode* mode;
+  uint32_t renderEma, presentEma;  // us
+  int hold;                        // frames until the next change
+  int upHold;                      // frames until the next step up
+  int backoff;                     // upHold multiplier
+  int sinceUp;                     // frames since the last step up
+  int clock;                       // index into govMhz
+  uint16_t hist[GOV_HIST_MS];
+  uint32_t frames;
+};
+
+static Governor _gov;
+
+static void govSetClock(int c) {
+  _gov.clock = c;
+#if defined(ARDUINO) && GOV_CPU_SCALING
+  setCpuFrequencyMhz(govMhz[c]);
+#endif
+}
+
+// Start governing mode m (nullptr: just keep stats)
+static void govSelect(const GovMode* m) {
+  memset(&_gov, 0, sizeof(_gov));
+  _gov.mode = m;
+  _gov.hold = GOV_HOLD_FRAMES;
+  _gov.backoff = 1;
+  _gov.sinceUp = 1 << 30;
+  govSetClock(GOV_CLOCKS - 1);
+}
+
+// Render time per frame that keeps the current mode on target: the
+// target minus the push. Zero when the push alone is over target, or
+// when no mode is governed.
+static uint32_t govRenderBudget() {
+  const GovMode* m = _gov.mode;
+  return m && m->targetUs > _gov.presentEma ? m->targetUs - _gov.presentEma : 0;
+}
+
+static bool govKnobsMaxed() {
+  const GovMode* m = _gov.mode;
+  for (int n = 0; m && n < m->count; n++) {
+    if (*m->knobs[n].value < m->knobs[n].hi) return false;
+  }
+  return true;
+}
+
+static bool govStep(int dir) {
+  const GovMode* m = _gov.mode;
+  for (int n = 0; n < m->count; n++) {
+    const GovKnob& k = m->knobs[dir < 0 ? n : m->count - 1 - n];
+    int v = *k.value + dir * k.step;
+    if (v < k.lo) v = k.lo;
+    if (v > k.hi) v = k.hi;
+    if (v != *k.value) {
+      *k.value = v;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void govFrame(uint32_t renderUs, uint32_t presentUs) {
+  Governor& g = _gov;
+  uint32_t ms = (renderUs + presentUs) / 1000;
+  uint16_t& bucket = g.hist[ms < GOV_HIST_MS ? ms : GOV_HIST_MS - 1];
+  if (bucket < 0xFFFF) bucket++;
+  if (g.frames < 0xFFFF) g.frames++;
+  g.renderEma = g.renderEma ? (g.renderEma * 7 + renderUs) >> 3 : renderUs;
+  g.presentEma = g.presentEma ? (g.presentEma * 7 + presentUs) >> 3 : presentUs;
+  if (g.sinceUp < 1 << 30) g.sinceUp++;
+  if (g.upHold > 0) g.upHold--;
+  if (g.hold > 0) g.hold--;
+  if (!g.mode || g.hold > 0) return;
+  const bool topClock = g.clock == GOV_CLOCKS - 1;
+  // Zero when the push alone is over target; then only the clock helps
+  uint32_t budget = govRenderBudget();
+
+  if (g.renderEma > budget) {
+    if (!topClock) govSetClock(g.clock + 1);
+    else if (!budget || !govStep(-1)) return;
+    if (g.sinceUp < 4 * GOV_HOLD_FRAMES && g.backoff < GOV_MAX_BACKOFF) g.backoff *= 2;
+    g.upHold = GOV_HOLD_FRAMES * g.backoff;
+  } else if (g.upHold > 0) {
+    return;
+  } else if ((uint64_t)g.renderEma * 100 < (uint64_t)budget * GOV_RAISE_PCT && topClock && govStep(1)) {
+    g.sinceUp = 0;
+  } else if (GOV_CPU_SCALING && g.clock > 0 && govKnobsMaxed() &&
+             (uint64_t)g.renderEma * govMhz[g.clock] * 100 <
+             (uint64_t)budget * govMhz[g.clock - 1] * GOV_CLOCK_PCT) {
+    govSetClock(g.clock - 1);
+    g.sinceUp = 0;
+  } else {
+    return;
+  }
+  g.hold = GOV_HOLD_FRAMES;
+}
+
+// Frame time (render + present) at or under which pct% of this visit's
+// frames finished, in ms; GOV_HIST_MS means slower than the histogram
+static inline int govPercentile(int pct) {
+  uint32_t need = (_gov.frames * pct + 99) / 100, seen = 0;
+  for (int i = 0; i < GOV_HIST_MS; i++) {
+    seen += _gov.hist[i];
+    if (seen >= need) return i + 1;
+  }
+  return GOV_HIST_MS;
+}
+
+// One-line summary of this visit: percentiles, EMAs and knob values
+static inline void govFormat(char* out, size_t size) {
+  int n = snprintf(out, size, "p50 %d ms, p90 %d ms, p99 %d ms over %lu frames, render %lu us, present %lu us",
+                   govPercentile(50), govPercentile(90), govPercentile(99), (unsigned long)_gov.frames,
+                   (unsigned long)_gov.renderEma, (unsigned long)_gov.presentEma);
+  if (n > 0 && (size_t)n < size) n += snprintf(out + n, size - n, ", cpu %d MHz", govMhz[_gov.clock]);
+  const GovMode* m = _gov.mode;
+  for (int i = 0; m && i < m->count && n > 0 && (size_t)n < size; i++) {
+    n += snprintf(out + n, size - n, "%s %s %d", i ? "," : ";", m->knobs[i].name, *m->knobs[i].value);
+  }
+}
+
+// One CSV sample for power traces (power_trace.py reads these):
+// trace,<ms>,<mode>,<cpu MHz>,<render us>,<present us>,<current mA>
+static inline void govTrace(char* out, size_t size, uint32_t ms, int mode, int32_t mA) {
+  snprintf(out, size, "trace,%lu,%d,%d,%lu,%lu,%ld", (unsigned long)ms, mode, govMhz[_gov.clock],
+           (unsigned long)_gov.renderEma, (unsigned long)_gov.presentEma, (long)mA);
+}
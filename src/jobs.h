@@ -0,0 +1,154 @@
+#pragma once
+// Band-parallel job system
+// Splits a range (usually screen rows) into bands and runs a kernel on
+// both ESP32-S3 cores: the calling task works through bands alongside a
+// worker pinned to core 0, and jobsRun() returns once every band is done
+// (the barrier). On a desktop host the worker is a std::thread pool, so
+// the same kernels can be built and timed on Linux.
+//
+// Kernels must only write rows inside their [begin, end) band and must
+// not call into LovyanGFX/FastLED — those are not thread safe.
+
+#include <stdint.h>
+#include <atomic>
+
+typedef void (*JobKernel)(void* ctx, int begin, int end);
+
+#define JOB_BAND 8  // rows grabbed per fetch; small bands balance uneven work
+
+struct JobBatch {
+  JobKernel fn;
+  void* ctx;
+  int count;
+  int band;
+  std::atomic<int> next;
+};
+
+static JobBatch _jobBatch;
+
+// Pull bands off the shared counter until the range is exhausted
+static void jobsDrain(JobBatch& b) {
+  for (;;) {
+    int i = b.next.fetch_add(b.band, std::memory_order_relaxed);
+    if (i >= b.count) break;
+    int e = i + b.band;
+    if (e > b.count) e = b.count;
+    b.fn(b.ctx, i, e);
+  }
+}
+
+#ifdef ARDUINO
+// ------------------------------------------------------------
+// ESP32: one worker task on core 0 (Arduino loop runs on core 1)
+// ------------------------------------------------------------
+#include <Arduino.h>
+
+#define JOB_STACK 8192
+
+static TaskHandle_t _jobWorker = nullptr;
+static TaskHandle_t _jobCaller = nullptr;
+
+static void jobWorkerTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    jobsDrain(_jobBatch);
+    xTaskNotifyGive(_jobCaller);
+  }
+}
+
+static void jobsBegin() {
+  if (_jobWorker) return;
+  xTaskCreatePinnedToCore(jobWorkerTask, "jobs", JOB_STACK, nullptr, 1, &_jobWorker, 0);
+}
+
+static inline int jobsThreads() { return _jobWorker ? 2 : 1; }
+
+static void jobsRun(JobKernel fn, void* ctx, int count, int band = JOB_BAND) {
+  if (!_jobWorker || count <= band) { fn(ctx, 0, count); return; }
+  _jobBatch.fn = fn;
+  _jobBatch.ctx = ctx;
+  _jobBatch.count = count;
+  _jobBatch.band = band;
+  _jobBatch.next.store(0, std::memory_order_release);
+  _jobCaller = xTaskGetCurrentTaskHandle();
+  xTaskNotifyGive(_jobWorker);
+  jobsDrain(_jobBatch);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // barrier: worker finished its bands
+}
+
+#else
+// ------------------------------------------------------------
+// Host: std::thread pool, JOB_HOST_THREADS workers plus the caller
+// ------------------------------------------------------------
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifndef JOB_HOST_THREADS
+#define JOB_HOST_THREADS 1  // 1 worker + caller mirrors the two ESP32 cores
+#endif
+
+// Heap-allocated and never freed: detached workers still wait on these
+// when static destructors run at exit
+struct JobHost {
+  std::mutex mutex;
+  std::condition_variable wake, done;
+  uint32_t generation = 0;
+  int pending = 0;
+};
+static JobHost* _jobHost = nullptr;
+static int _jobWorkers = 0;
+
+static void jobWorkerThread() {
+  JobHost& h = *_jobHost;
+  uint32_t seen = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(h.mutex);
+      h.wake.wait(lock, [&] { return h.generation != seen; });
+      seen = h.generation;
+    }
+    jobsDrain(_jobBatch);
+    std::lock_guard<std::mutex> lock(h.mutex);
+    if (--h.pending == 0) h.done.notify_one();
+  }
+}
+
+static void jobsBegin() {
+  if (_jobHost) return;
+  _jobHost = new JobHost;
+  for (int i = 0; i < JOB_HOST_THREADS; i++) {
+    std::thread(jobWorkerThread).detach();
+  }
+  _jobWorkers = JOB_HOST_THREADS;
+}
+
+static inline int jobsThreads() { return _jobWorkers + 1; }
+
+static void jobsRun(JobKernel fn, void* ctx, int count, int band = JOB_BAND) {
+  if (!_jobWorkers || count <= band) { fn(ctx, 0, count); return; }
+  JobHost& h = *_jobHost;
+  {
+    std::lock_guard<std::mutex> lock(h.mutex);
+    _jobBatch.fn = fn;
+    _jobBatch.ctx = ctx;
+    _jobBatch.count = count;
+    _jobBatch.band = band;
+    _jobBatch.next.store(0, std::memory_order_relaxed);
+    h.pending = _jobWorkers;
+    h.generation++;
+  }
+  h.wake.notify_all();
+  jobsDrain(_jobBatch);
+  std::unique_lock<std::mutex> lock(h.mutex);
+  h.done.wait(lock, [&] { return h.pending == 0; });
+}
+#endif
+
+// Run fn(begin, end) over [0, count) in bands on all cores.
+// fn is usually a capturing lambda; it lives on the caller's stack
+// for the whole call, so capturing by reference is safe.
+template <typename F>
+static void jobsFor(int count, F fn, int band = JOB_BAND) {
+  jobsRun([](void* c, int b, int e) { (*(F*)c)(b, e); }, &fn, count, band);
+}
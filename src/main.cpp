@@ -1,5 +1,6 @@
 // Classic Screensavers — M5Stack CoreS3 SE
-// 6 modes: Flying Toasters, Pipes, Starfield, Matrix Rain, Mystify, Bouncing Logo
+// 11 modes: Flying Toasters, Pipes, Starfield, Matrix Rain, Mystify, Bouncing Logo,
+// Fire, Life, Mandelbrot, Polyhedra, 3D Maze
 // Touch to cycle modes. NeoPixels ambient glow. Runs forever as desk piece.
 
 #include <M5Unified.h>
@@ -7,6 +8,14 @@
 // #include <SD.h>  // Uncomment for screenshot feature
 #include "toaster_sprites.h"
 #include "dvd_logo.h"
+#include "jobs.h"
+#include "fastmath.h"
+#include "prng.h"
+#include "fixed.h"
+#include "governor.h"
+#include "strips.h"
+#include "luts.h"
+#include "maze_textures.h"
 
 // --- Hardware ---
 static M5GFX& lcd = M5.Display;
@@ -43,7 +52,16 @@ static inline uint8_t rgb332_dim(uint8_t c, uint8_t factor) {
 }
 
 // --- LUT ---
-static uint8_t fadeLUT[256];
+// fadeLUT (RGB332 dim to ~85%) is generated into flash by gen_luts.py
+
+// Dim the whole frame one fadeLUT step, on both cores
+static void fadeBuffer(uint8_t* buf) {
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int i = y0 * SCR_W; i < y1 * SCR_W; i++) {
+      buf[i] = fadeLUT[buf[i]];
+    }
+  });
+}
 
 // --- Mode management ---
 enum Mode {
@@ -53,6 +71,11 @@ enum Mode {
   MODE_MATRIX,
   MODE_MYSTIFY,
   MODE_BOUNCE,
+  MODE_FIRE,
+  MODE_LIFE,
+  MODE_MANDEL,
+  MODE_POLY,
+  MODE_MAZE,
   MODE_COUNT
 };
 static Mode currentMode = MODE_TOASTERS;
@@ -62,23 +85,50 @@ static bool transitioning = false;
 static int transPhase = 0;
 static uint32_t transStart = 0;
 #define TRANS_DURATION 1000
+static Mode nextMode = MODE_TOASTERS;  // chosen at transition start
+static int prewarmPos = 0;              // init progress of nextMode
+static bool prewarmDone = false;
 
 // --- Timing ---
 static uint32_t frameCount = 0;
 
+// --- Random streams, one per mode (prng.h) ---
+#define PRNG_SEED 0  // 0 = new sequence every boot, else replay the same run
+static Prng rngToasters, rngPipes, rngStars, rngMatrix, rngMystify, rngBounce, rngFire, rngLife, rngPoly,
+            rngMaze;
+static Prng rngSystem;  // mode durations
+
+// Serial frame-time report at the end of every transition
+#define ENABLE_PERF_LOG 0
+#if ENABLE_PERF_LOG
+static uint32_t perfLastUs = 0;
+static uint32_t perfSteadyUs = 0;  // EMA of frame time outside transitions
+static uint32_t perfWorstUs = 0;   // worst frame since transition start
+static uint32_t perfRenderUs = 0;  // EMA of the outgoing mode's render call
+#endif
+
+// CSV sample (clock, frame times, battery current) over serial every
+// POWER_TRACE_MS, for power_trace.py
+#define ENABLE_POWER_TRACE 0
+#define POWER_TRACE_MS 1000
+#if ENABLE_POWER_TRACE
+static uint32_t traceLastMs = 0;
+#endif
+
 // --- NeoPixel smoothing ---
 static uint8_t neoR[NUM_LEDS], neoG[NUM_LEDS], neoB[NUM_LEDS];
 
 // ============================================================
 // Bresenham line drawing (into RGB332 buffer)
 // ============================================================
-static void drawLine(uint8_t* buf, int x0, int y0, int x1, int y1, uint8_t color) {
+// Into a band: buf holds only screen rows [by0, by1)
+static void drawLineBand(uint8_t* buf, int by0, int by1, int x0, int y0, int x1, int y1, uint8_t color) {
   int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
   int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
   int err = dx + dy;
   for (;;) {
-    if (x0 >= 0 && x0 < SCR_W && y0 >= 0 && y0 < SCR_H)
-      buf[y0 * SCR_W + x0] = color;
+    if (x0 >= 0 && x0 < SCR_W && y0 >= by0 && y0 < by1)
+      buf[(y0 - by0) * SCR_W + x0] = color;
     if (x0 == x1 && y0 == y1) break;
     int e2 = 2 * err;
     if (e2 >= dy) { err += dy; x0 += sx; }
@@ -86,6 +136,10 @@ static void drawLine(uint8_t* buf, int x0, int y0, int x1, int y1, uint8_t color
   }
 }
 
+static void drawLine(uint8_t* buf, int x0, int y0, int x1, int y1, uint8_t color) {
+  drawLineBand(buf, 0, SCR_H, x0, y0, x1, y1, color);
+}
+
 // ============================================================
 // Filled circle (midpoint algorithm)
 // ============================================================
@@ -111,7 +165,7 @@ static void fillCircle(uint8_t* buf, int cx, int cy, int r, uint8_t color) {
 // ============================================================
 // Filled rectangle
 // ============================================================
-static void fillRect(uint8_t* buf, int x, int y, int w, int h, uint8_t color) {
+static inline void fillRect(uint8_t* buf, int x, int y, int w, int h, uint8_t color) {
   for (int row = y; row < y + h; row++) {
     if (row < 0 || row >= SCR_H) continue;
     int lx = x < 0 ? 0 : x;
@@ -205,7 +259,7 @@ static void drawChar5x7(uint8_t* buf, int cx, int cy, char ch, uint8_t color) {
   }
 }
 
-static void drawString5x7(uint8_t* buf, int x, int y, const char* str, uint8_t color) {
+static inline void drawString5x7(uint8_t* buf, int x, int y, const char* str, uint8_t color) {
   while (*str) {
     drawChar5x7(buf, x, y, *str, color);
     x += 6;
@@ -216,10 +270,10 @@ static void drawString5x7(uint8_t* buf, int x, int y, const char* str, uint8_t c
 // ============================================================
 // MODE 1: Flying Toasters
 // ============================================================
-#define MAX_FLYERS 15
+#define MAX_FLYERS 24
+static int flyerCount = 15;            // governed, up to MAX_FLYERS
 struct FlyingObject {
-  float x, y;
-  float vx, vy;
+  PxVec pos, vel;
   uint8_t frame;
   uint8_t frameDelay;
   uint8_t frameCounter;
@@ -230,14 +284,14 @@ static FlyingObject flyers[MAX_FLYERS];
 static void initToasters() {
   for (int i = 0; i < MAX_FLYERS; i++) {
     FlyingObject& f = flyers[i];
-    f.isToast = (i >= 10);  // last 5 are toast
-    f.x = random(0, SCR_W + 100);
-    f.y = random(-100, SCR_H);
-    float speed = 1.0f + random(0, 20) * 0.1f;  // 1.0-3.0
-    f.vx = -speed;
-    f.vy = speed * 0.6f;
-    f.frame = random(0, NUM_TOASTER_FRAMES);
-    f.frameDelay = random(3, 8);
+    f.isToast = (i % 3 == 2);  // every third is toast
+    f.pos.x = Px::fromInt(prngRange(rngToasters, 0, SCR_W + 100));
+    f.pos.y = Px::fromInt(prngRange(rngToasters, -100, SCR_H));
+    // 1.0-3.0 px/frame at 0.6 slope, each component rounded to 1/64 px
+    int tenths = 10 + prngRange(rngToasters, 0, 20);
+    f.vel = PxVec(-Px::fromRaw((tenths * Px::ONE + 5) / 10), Px::fromRaw((tenths * Px::ONE * 3 + 25) / 50));
+    f.frame = prngRange(rngToasters, 0, NUM_TOASTER_FRAMES);
+    f.frameDelay = prngRange(rngToasters, 3, 8);
     f.frameCounter = 0;
   }
 }
@@ -268,10 +322,9 @@ static void renderToasters(uint8_t* buf) {
   // Dark blue background
   memset(buf, rgb332(0, 0, 40), SCR_W * SCR_H);
 
-  for (int i = 0; i < MAX_FLYERS; i++) {
+  for (int i = 0; i < flyerCount; i++) {
     FlyingObject& f = flyers[i];
-    f.x += f.vx;
-    f.y += f.vy;
+    f.pos += f.vel;
 
     // Wrap around
     uint8_t fw, fh;
@@ -282,8 +335,8 @@ static void renderToasters(uint8_t* buf) {
       fw = pgm_read_byte(&toasterFrames[0].w);
       fh = pgm_read_byte(&toasterFrames[0].h);
     }
-    if (f.x < -(int)fw - 10) f.x = SCR_W + random(10, 60);
-    if (f.y > SCR_H + 10) f.y = -fh - random(10, 60);
+    if (f.pos.x.toInt() < -(int)fw - 10) f.pos.x = Px::fromInt(SCR_W + prngRange(rngToasters, 10, 60));
+    if (f.pos.y.toInt() > SCR_H + 10) f.pos.y = Px::fromInt(-fh - prngRange(rngToasters, 10, 60));
 
     // Animate toasters
     if (!f.isToast) {
@@ -292,9 +345,9 @@ static void renderToasters(uint8_t* buf) {
         f.frameCounter = 0;
         f.frame = (f.frame + 1) % NUM_TOASTER_FRAMES;
       }
-      blitSprite(buf, &toasterFrames[f.frame], (int)f.x, (int)f.y);
+      blitSprite(buf, &toasterFrames[f.frame], f.pos.x.toInt(), f.pos.y.toInt());
     } else {
-      blitSprite(buf, &toastFrame, (int)f.x, (int)f.y);
+      blitSprite(buf, &toastFrame, f.pos.x.toInt(), f.pos.y.toInt());
     }
   }
 }
@@ -337,23 +390,23 @@ static void initPipes() {
 }
 
 static void startNewPipe(PipeState& p) {
-  int edge = random(0, 4);
+  int edge = prngRange(rngPipes, 0, 4);
   switch (edge) {
-    case 0: p.px = random(20, SCR_W - 20); p.py = 0; p.dx = 0; p.dy = 1; break;
-    case 1: p.px = random(20, SCR_W - 20); p.py = SCR_H - 1; p.dx = 0; p.dy = -1; break;
-    case 2: p.px = 0; p.py = random(20, SCR_H - 20); p.dx = 1; p.dy = 0; break;
-    default: p.px = SCR_W - 1; p.py = random(20, SCR_H - 20); p.dx = -1; p.dy = 0; break;
+    case 0: p.px = prngRange(rngPipes, 20, SCR_W - 20); p.py = 0; p.dx = 0; p.dy = 1; break;
+    case 1: p.px = prngRange(rngPipes, 20, SCR_W - 20); p.py = SCR_H - 1; p.dx = 0; p.dy = -1; break;
+    case 2: p.px = 0; p.py = prngRange(rngPipes, 20, SCR_H - 20); p.dx = 1; p.dy = 0; break;
+    default: p.px = SCR_W - 1; p.py = prngRange(rngPipes, 20, SCR_H - 20); p.dx = -1; p.dy = 0; break;
   }
-  p.color = pipeColors[random(0, sizeof(pipeColors))];
+  p.color = pipeColors[prngRange(rngPipes, 0, sizeof(pipeColors))];
   p.highlight = rgb332_dim(p.color, 255);
   p.shadow = rgb332_dim(p.color, 100);
-  p.segLen = random(40, 140);
+  p.segLen = prngRange(rngPipes, 40, 140);
   p.segProgress = 0;
   p.active = true;
 }
 
 // Draw one pixel-row of pipe cross-section at (cx,cy) with shading
-static void drawPipeSlice(uint8_t* buf, int cx, int cy, int dx, int dy,
+static void drawPipeSlice(uint8_t* buf, int cx, int cy, int dx, int /*dy*/,
                            uint8_t base, uint8_t hi, uint8_t sh) {
   if (dx != 0) {
     // Moving horizontally: draw vertical slice with top highlight, bottom shadow
@@ -406,12 +459,12 @@ static void advancePipe(uint8_t* buf, PipeState& p) {
     // Pick perpendicular direction
     if (p.dx != 0) {
       p.dx = 0;
-      p.dy = random(0, 2) ? 1 : -1;
+      p.dy = prngRange(rngPipes, 0, 2) ? 1 : -1;
     } else {
       p.dy = 0;
-      p.dx = random(0, 2) ? 1 : -1;
+      p.dx = prngRange(rngPipes, 0, 2) ? 1 : -1;
     }
-    p.segLen = random(40, 140);
+    p.segLen = prngRange(rngPipes, 40, 140);
     p.segProgress = 0;
   }
 }
@@ -423,13 +476,16 @@ static void renderPipes(uint8_t* buf) {
   memcpy(buf, otherBuf, SCR_W * SCR_H);
 
   if (pipeFading) {
-    int total = SCR_W * SCR_H;
-    bool allBlack = true;
-    for (int i = 0; i < total; i++) {
-      buf[i] = fadeLUT[buf[i]];
-      if (buf[i] != 0) allBlack = false;
-    }
-    if (allBlack) {
+    std::atomic<bool> anyLit(false);
+    jobsFor(SCR_H, [&](int y0, int y1) {
+      uint8_t lit = 0;
+      for (int i = y0 * SCR_W; i < y1 * SCR_W; i++) {
+        buf[i] = fadeLUT[buf[i]];
+        lit |= buf[i];
+      }
+      if (lit) anyLit.store(true, std::memory_order_relaxed);
+    });
+    if (!anyLit.load()) {
       initPipes();
       memset(buf, 0, SCR_W * SCR_H);
     }
@@ -451,54 +507,73 @@ static void renderPipes(uint8_t* buf) {
 // ============================================================
 // MODE 3: Starfield
 // ============================================================
-#define MAX_STARS 500
+#define MAX_STARS 1000
+static int starCount = 500;            // governed, up to MAX_STARS
+typedef Fixed<8, int16_t> Depth;  // Q7.8
 struct Star {
-  float x, y;   // screen-relative: (0,0)=center, units = pixels at z=1
-  float z;      // depth: starts at max, decreases toward 0 (viewer)
-  float pz;     // previous z for streak
+  int16_t x, y; // screen-relative: (0,0)=center, units = pixels at z=1
+  Depth z;      // depth: starts at max, decreases toward 0 (viewer)
+  Depth pz;     // previous z for streak
 };
 static Star* stars = nullptr;
-#define STAR_MAX_Z 32.0f
-#define STAR_SPEED 0.075f
+#define STAR_MAX_Z  Depth::fromInt(32)
+#define STAR_MIN_Z  Depth::fromFloat(0.1f)
+#define STAR_NEAR_Z Depth::fromFloat(4.8f)    // closest 15%: fat white dot
+#define STAR_SPEED  Depth::fromFloat(0.075f)
 
 static void spawnStar(Star& s, bool randomDepth) {
   // Spawn in screen coordinates: at z=STAR_MAX_Z these map to pixels
-  s.x = (float)(random(0, SCR_W) - SCR_W / 2);
-  s.y = (float)(random(0, SCR_H) - SCR_H / 2);
+  s.x = prngRange(rngStars, 0, SCR_W) - SCR_W / 2;
+  s.y = prngRange(rngStars, 0, SCR_H) - SCR_H / 2;
   if (randomDepth) {
-    s.z = random(1, (int)(STAR_MAX_Z * 10)) * 0.1f;
+    s.z = Depth::fromRaw(prngRange(rngStars, 1, STAR_MAX_Z.toInt() * 10) * Depth::ONE / 10);
   } else {
     s.z = STAR_MAX_Z;
   }
   s.pz = s.z;
 }
 
-static void initStarfield() {
+// This frame's projected stars: a streak from (x0, y0) to (x1, y1) and,
+// for close stars, a fat dot at (x1, y1). Kept so the frame can be
+// drawn a band at a time.
+struct StarSeg {
+  int16_t x0, y0, x1, y1;
+  uint8_t color;
+  bool dot;
+};
+static StarSeg* starSegs = nullptr;
+static int starSegCount = 0;
+
+// Init stars [from, to) — split so it can run across several frames
+static void initStarfield(int from, int to) {
   if (!stars) stars = (Star*)ps_malloc(MAX_STARS * sizeof(Star));
-  for (int i = 0; i < MAX_STARS; i++) {
+  if (!starSegs) {
+    starSegs = (StarSeg*)heap_caps_malloc(MAX_STARS * sizeof(StarSeg), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!starSegs) starSegs = (StarSeg*)ps_malloc(MAX_STARS * sizeof(StarSeg));
+  }
+  for (int i = from; i < to; i++) {
     spawnStar(stars[i], true);  // random depth so field is full at start
   }
 }
 
-static void renderStarfield(uint8_t* buf) {
-  memset(buf, 0, SCR_W * SCR_H);
-
-  float cx = SCR_W * 0.5f;
-  float cy = SCR_H * 0.5f;
-
-  for (int i = 0; i < MAX_STARS; i++) {
+// Move the stars and project them into starSegs
+static void starfieldStep() {
+  starSegCount = 0;
+  for (int i = 0; i < starCount; i++) {
     Star& s = stars[i];
     s.pz = s.z;
     s.z -= STAR_SPEED;
 
-    if (s.z <= 0.1f) {
+    if (s.z <= STAR_MIN_Z) {
       spawnStar(s, false);
       continue;
     }
 
-    // Project: divide by z for perspective
-    float sx = cx + s.x / s.z;
-    float sy = cy + s.y / s.z;
+    // Project: divide by z for perspective, as a Q16 table reciprocal
+    // (2^32 / (z * 256) >> 8 = 65536 / z)
+    int32_t iz = fmRecip(s.z.raw) >> 8;
+    int sx = SCR_W / 2 + ((s.x * iz) >> 16);
+    int sy = SCR_H / 2 + ((s.y * iz) >> 16);
 
     if (sx < 0 || sx >= SCR_W || sy < 0 || sy >= SCR_H) {
       spawnStar(s, false);
@@ -506,33 +581,54 @@ static void renderStarfield(uint8_t* buf) {
     }
 
     // Previous position for streak
-    float px = cx + s.x / s.pz;
-    float py = cy + s.y / s.pz;
+    int32_t ipz = fmRecip(s.pz.raw) >> 8;
+    int px = SCR_W / 2 + ((s.x * ipz) >> 16);
+    int py = SCR_H / 2 + ((s.y * ipz) >> 16);
 
     // Brightness: closer = brighter, linear with floor
-    float t = 1.0f - (s.z / STAR_MAX_Z);  // 0=far, 1=close
-    uint8_t bv = 40 + (uint8_t)(t * 215);  // range 40-255, always visible
-    uint8_t color = rgb332(bv, bv, bv);
-
-    drawLine(buf, (int)px, (int)py, (int)sx, (int)sy, color);
-
-    // Close stars: bright white fat dot
-    if (t > 0.85f) {
-      int ix = (int)sx, iy = (int)sy;
-      uint8_t white = rgb332(255, 255, 255);
-      if (ix >= 0 && ix < SCR_W && iy >= 0 && iy < SCR_H)
-        buf[iy * SCR_W + ix] = white;
-      if (ix+1 < SCR_W) buf[iy * SCR_W + ix + 1] = white;
-      if (iy+1 < SCR_H) buf[(iy+1) * SCR_W + ix] = white;
+    uint8_t bv = 40 + 215 * (STAR_MAX_Z - s.z).raw / STAR_MAX_Z.raw;  // range 40-255
+
+    StarSeg& g = starSegs[starSegCount++];
+    g.x0 = px; g.y0 = py; g.x1 = sx; g.y1 = sy;
+    g.color = rgb332(bv, bv, bv);
+    g.dot = s.z < STAR_NEAR_Z;  // close stars: bright white fat dot
+  }
+}
+
+// Rows [y0, y1) of the projected field into dst, SCR_W bytes per row
+static void starfieldBand(uint8_t* dst, int y0, int y1) {
+  memset(dst, 0, (y1 - y0) * SCR_W);
+  const uint8_t white = rgb332(255, 255, 255);
+  auto plot = [&](int x, int y) {
+    if (y >= y0 && y < y1) dst[(y - y0) * SCR_W + x] = white;
+  };
+  for (int i = 0; i < starSegCount; i++) {
+    const StarSeg& g = starSegs[i];
+    int top = g.y0 < g.y1 ? g.y0 : g.y1;
+    int bottom = (g.y0 > g.y1 ? g.y0 : g.y1) + g.dot;
+    if (bottom < y0 || top >= y1) continue;
+
+    drawLineBand(dst, y0, y1, g.x0, g.y0, g.x1, g.y1, g.color);
+    if (g.dot) {
+      plot(g.x1, g.y1);
+      if (g.x1 + 1 < SCR_W) plot(g.x1 + 1, g.y1);
+      if (g.y1 + 1 < SCR_H) plot(g.x1, g.y1 + 1);
     }
   }
 }
 
+static void renderStarfield(uint8_t* buf) {
+  starfieldStep();
+  starfieldBand(buf, 0, SCR_H);
+}
+
 // ============================================================
 // MODE 4: Matrix Rain
 // ============================================================
 #define MATRIX_COLS 40
 #define MATRIX_CHAR_W 8
+#define MATRIX_TRAIL_MAX 24            // trails are 8..24 characters
+static int matTrail = MATRIX_TRAIL_MAX;  // governed: longest trail drawn
 struct MatrixColumn {
   float headY;
   float speed;
@@ -543,18 +639,19 @@ struct MatrixColumn {
 static MatrixColumn matCols[MATRIX_COLS];
 
 static char randomMatrixChar() {
-  int r = random(0, 62);
+  int r = prngRange(rngMatrix, 0, 62);
   if (r < 26) return 'A' + r;
   if (r < 52) return 'a' + (r - 26);
   return '0' + (r - 52);
 }
 
-static void initMatrix() {
-  for (int i = 0; i < MATRIX_COLS; i++) {
+// Init columns [from, to) — split so it can run across several frames
+static void initMatrix(int from, int to) {
+  for (int i = from; i < to; i++) {
     MatrixColumn& c = matCols[i];
-    c.headY = random(-SCR_H, 0);
-    c.speed = 1.0f + random(0, 30) * 0.1f;
-    c.trailLen = random(8, 25);
+    c.headY = prngRange(rngMatrix, -SCR_H, 0);
+    c.speed = 1.0f + prngRange(rngMatrix, 0, 30) * 0.1f;
+    c.trailLen = prngRange(rngMatrix, 8, MATRIX_TRAIL_MAX + 1);
     c.charTimer = 0;
     for (int j = 0; j < 30; j++) c.chars[j] = randomMatrixChar();
   }
@@ -562,10 +659,7 @@ static void initMatrix() {
 
 static void renderMatrix(uint8_t* buf) {
   // Fade existing content
-  int total = SCR_W * SCR_H;
-  for (int i = 0; i < total; i++) {
-    buf[i] = fadeLUT[buf[i]];
-  }
+  fadeBuffer(buf);
 
   for (int i = 0; i < MATRIX_COLS; i++) {
     MatrixColumn& c = matCols[i];
@@ -575,7 +669,7 @@ static void renderMatrix(uint8_t* buf) {
     c.charTimer++;
     if (c.charTimer > 5) {
       c.charTimer = 0;
-      c.chars[random(0, 30)] = randomMatrixChar();
+      c.chars[prngRange(rngMatrix, 0, 30)] = randomMatrixChar();
     }
 
     int hx = i * MATRIX_CHAR_W;
@@ -587,10 +681,11 @@ static void renderMatrix(uint8_t* buf) {
     }
 
     // Draw body (green, fading)
-    for (int j = 1; j < c.trailLen; j++) {
+    int trail = c.trailLen < matTrail ? c.trailLen : matTrail;
+    for (int j = 1; j < trail; j++) {
       int ty = hy - j * 8;
       if (ty < 0 || ty >= SCR_H) continue;
-      float fade = 1.0f - (float)j / c.trailLen;
+      float fade = 1.0f - (float)j / trail;
       uint8_t g = (uint8_t)(200 * fade);
       uint8_t r_val = (uint8_t)(40 * fade);
       drawChar5x7(buf, hx, ty, c.chars[j % 30], rgb332(r_val, g, 0));
@@ -598,9 +693,9 @@ static void renderMatrix(uint8_t* buf) {
 
     // Wrap when head goes off bottom
     if (hy > SCR_H + c.trailLen * 8) {
-      c.headY = random(-40, -8);
-      c.speed = 1.0f + random(0, 30) * 0.1f;
-      c.trailLen = random(8, 25);
+      c.headY = prngRange(rngMatrix, -40, -8);
+      c.speed = 1.0f + prngRange(rngMatrix, 0, 30) * 0.1f;
+      c.trailLen = prngRange(rngMatrix, 8, MATRIX_TRAIL_MAX + 1);
       for (int j = 0; j < 30; j++) c.chars[j] = randomMatrixChar();
     }
   }
@@ -609,75 +704,68 @@ static void renderMatrix(uint8_t* buf) {
 // ============================================================
 // MODE 5: Mystify (bouncing quadrilaterals with trails)
 // ============================================================
-#define MYSTIFY_SHAPES 2
+#define MYSTIFY_SHAPES 4
+static int mystCount = 2;              // governed, up to MYSTIFY_SHAPES
 #define MYSTIFY_VERTS 4
 struct MystifyShape {
-  float x[MYSTIFY_VERTS], y[MYSTIFY_VERTS];
-  float vx[MYSTIFY_VERTS], vy[MYSTIFY_VERTS];
-  float hue;
-  float hueSpeed;
+  PxVec pos[MYSTIFY_VERTS];
+  PxVec vel[MYSTIFY_VERTS];
+  uint16_t hue;       // binary angle, 65536 = full turn
+  uint16_t hueSpeed;
 };
 static MystifyShape mystShapes[MYSTIFY_SHAPES];
 
-static uint8_t hsvToRgb332(float h, float s, float v) {
-  float c = v * s;
-  float x = c * (1.0f - fabsf(fmodf(h / 60.0f, 2.0f) - 1.0f));
-  float m = v - c;
-  float rf, gf, bf;
-  if (h < 60)       { rf = c; gf = x; bf = 0; }
-  else if (h < 120) { rf = x; gf = c; bf = 0; }
-  else if (h < 180) { rf = 0; gf = c; bf = x; }
-  else if (h < 240) { rf = 0; gf = x; bf = c; }
-  else if (h < 300) { rf = x; gf = 0; bf = c; }
-  else               { rf = c; gf = 0; bf = x; }
-  return rgb332((uint8_t)((rf + m) * 255), (uint8_t)((gf + m) * 255), (uint8_t)((bf + m) * 255));
+// ±1.5-3.5 px/frame
+static Px randomVertexSpeed() {
+  int sign = prngRange(rngMystify, 0, 2) ? 1 : -1;
+  int tenths = 15 + prngRange(rngMystify, 0, 20);
+  return Px::fromRaw((tenths * Px::ONE + 5) / 10) * sign;
 }
 
 static void initMystify() {
   for (int s = 0; s < MYSTIFY_SHAPES; s++) {
     MystifyShape& m = mystShapes[s];
-    m.hue = random(0, 360);
-    m.hueSpeed = 0.3f + random(0, 10) * 0.1f;
+    m.hue = (uint16_t)prngNext(rngMystify);
+    m.hueSpeed = (uint16_t)((0.3f + prngRange(rngMystify, 0, 10) * 0.1f) * (65536.0f / 360.0f));  // 0.3-1.2 deg/frame
     for (int v = 0; v < MYSTIFY_VERTS; v++) {
-      m.x[v] = random(10, SCR_W - 10);
-      m.y[v] = random(10, SCR_H - 10);
-      m.vx[v] = (random(0, 2) ? 1.0f : -1.0f) * (1.5f + random(0, 20) * 0.1f);
-      m.vy[v] = (random(0, 2) ? 1.0f : -1.0f) * (1.5f + random(0, 20) * 0.1f);
+      m.pos[v].x = Px::fromInt(prngRange(rngMystify, 10, SCR_W - 10));
+      m.pos[v].y = Px::fromInt(prngRange(rngMystify, 10, SCR_H - 10));
+      m.vel[v].x = randomVertexSpeed();
+      m.vel[v].y = randomVertexSpeed();
     }
   }
 }
 
 static void renderMystify(uint8_t* buf) {
   // Fade trails
-  int total = SCR_W * SCR_H;
-  for (int i = 0; i < total; i++) {
-    buf[i] = fadeLUT[buf[i]];
-  }
+  fadeBuffer(buf);
 
-  for (int s = 0; s < MYSTIFY_SHAPES; s++) {
+  for (int s = 0; s < mystCount; s++) {
     MystifyShape& m = mystShapes[s];
-    m.hue = fmodf(m.hue + m.hueSpeed, 360.0f);
-    uint8_t color = hsvToRgb332(m.hue, 1.0f, 1.0f);
+    m.hue += m.hueSpeed;  // wraps at a full turn
+    uint8_t color = fmHue332[m.hue >> 8];
 
     // Update vertices
     for (int v = 0; v < MYSTIFY_VERTS; v++) {
-      m.x[v] += m.vx[v];
-      m.y[v] += m.vy[v];
-
-      if (m.x[v] <= 0 || m.x[v] >= SCR_W - 1) {
-        m.vx[v] = -m.vx[v];
-        m.x[v] = m.x[v] <= 0 ? 0 : SCR_W - 1;
+      PxVec& p = m.pos[v];
+      PxVec& d = m.vel[v];
+      p += d;
+
+      const Px maxX = Px::fromInt(SCR_W - 1), maxY = Px::fromInt(SCR_H - 1);
+      if (p.x <= Px() || p.x >= maxX) {
+        d.x = -d.x;
+        p.x = p.x <= Px() ? Px() : maxX;
       }
-      if (m.y[v] <= 0 || m.y[v] >= SCR_H - 1) {
-        m.vy[v] = -m.vy[v];
-        m.y[v] = m.y[v] <= 0 ? 0 : SCR_H - 1;
+      if (p.y <= Px() || p.y >= maxY) {
+        d.y = -d.y;
+        p.y = p.y <= Px() ? Px() : maxY;
       }
     }
 
     // Draw closed quadrilateral
     for (int v = 0; v < MYSTIFY_VERTS; v++) {
       int nv = (v + 1) % MYSTIFY_VERTS;
-      drawLine(buf, (int)m.x[v], (int)m.y[v], (int)m.x[nv], (int)m.y[nv], color);
+      drawLine(buf, m.pos[v].x.toInt(), m.pos[v].y.toInt(), m.pos[nv].x.toInt(), m.pos[nv].y.toInt(), color);
     }
   }
 }
@@ -686,8 +774,7 @@ static void renderMystify(uint8_t* buf) {
 // MODE 6: Bouncing DVD Logo (real logo sprite, runtime colorized)
 // ============================================================
 struct BounceLogo {
-  float x, y;
-  float vx, vy;
+  PxVec pos, vel;
   uint8_t colorIdx;
 };
 static BounceLogo dvdLogo;
@@ -704,10 +791,9 @@ static uint8_t rainbowColors[] = {
 #define NUM_RAINBOW 7
 
 static void initBounce() {
-  dvdLogo.x = random(0, SCR_W - DVD_LOGO_W);
-  dvdLogo.y = random(0, SCR_H - DVD_LOGO_H);
-  dvdLogo.vx = 2.0f;
-  dvdLogo.vy = 1.5f;
+  dvdLogo.pos.x = Px::fromInt(prngRange(rngBounce, 0, SCR_W - DVD_LOGO_W));
+  dvdLogo.pos.y = Px::fromInt(prngRange(rngBounce, 0, SCR_H - DVD_LOGO_H));
+  dvdLogo.vel = PxVec(Px::fromFloat(2.0f), Px::fromFloat(1.5f));
   dvdLogo.colorIdx = 0;
 }
 
@@ -729,20 +815,1113 @@ static void blitDvdLogo(uint8_t* buf, int dx, int dy, uint8_t color) {
 static void renderBounce(uint8_t* buf) {
   memset(buf, 0, SCR_W * SCR_H);
 
-  dvdLogo.x += dvdLogo.vx;
-  dvdLogo.y += dvdLogo.vy;
+  PxVec& p = dvdLogo.pos;
+  PxVec& v = dvdLogo.vel;
+  p += v;
 
   bool bounced = false;
-  if (dvdLogo.x <= 0) { dvdLogo.vx = fabsf(dvdLogo.vx); bounced = true; }
-  if (dvdLogo.x >= SCR_W - DVD_LOGO_W) { dvdLogo.vx = -fabsf(dvdLogo.vx); bounced = true; }
-  if (dvdLogo.y <= 0) { dvdLogo.vy = fabsf(dvdLogo.vy); bounced = true; }
-  if (dvdLogo.y >= SCR_H - DVD_LOGO_H) { dvdLogo.vy = -fabsf(dvdLogo.vy); bounced = true; }
+  if (p.x <= Px()) { v.x = v.x.abs(); bounced = true; }
+  if (p.x >= Px::fromInt(SCR_W - DVD_LOGO_W)) { v.x = -v.x.abs(); bounced = true; }
+  if (p.y <= Px()) { v.y = v.y.abs(); bounced = true; }
+  if (p.y >= Px::fromInt(SCR_H - DVD_LOGO_H)) { v.y = -v.y.abs(); bounced = true; }
 
   if (bounced) {
     dvdLogo.colorIdx = (dvdLogo.colorIdx + 1) % NUM_RAINBOW;
   }
 
-  blitDvdLogo(buf, (int)dvdLogo.x, (int)dvdLogo.y, rainbowColors[dvdLogo.colorIdx]);
+  blitDvdLogo(buf, p.x.toInt(), p.y.toInt(), rainbowColors[dvdLogo.colorIdx]);
+}
+
+// ============================================================
+// MODE 7: Fire (Doom-style, SWAR)
+// ============================================================
+// Bottom-up in place, as in Doom: each row is built from the row below
+// as updated this frame, so a cell's heat is the fuel minus the decays
+// along a random walk, and walks shared by neighbours in a column form
+// the flame tongues. Per cell: drift one cell left or right (1/4 each),
+// then lose 1 with probability 3/4.
+//
+// Cells are packed four per 32-bit word and every step works on all
+// four at once:
+//   drift  — the row below is also read funnel-shifted one cell each
+//            way; random byte masks pick one of the three per cell
+//   decay  — (w | 0x80 per byte) - d never borrows across bytes; a byte
+//            whose 0x80 got eaten underflowed and is masked to zero
+// Rows have a zero word on both sides, so drift needs no edge tests.
+// The bottom row (FIRE_H) is the fuel and never changes.
+//
+// Each core takes a vertical strip. Drift doesn't cross strip edges
+// (the edge cell reads itself instead), so strips are independent.
+// A strip stops at its first empty row: nothing above it can be hot.
+#define FIRE_SCALE 2                   // 2 = 160x120 heat upscaled, 1 = full 320x240
+#define FIRE_W (SCR_W / FIRE_SCALE)
+#define FIRE_H (SCR_H / FIRE_SCALE)
+#define FIRE_WORDS (FIRE_W / 4)
+#define FIRE_STRIDE (FIRE_WORDS + 2)   // words per row, pads included
+#define FIRE_STRIPS 2                  // one per core
+#define FIRE_STRIP_WORDS (FIRE_WORDS / FIRE_STRIPS)
+#if FIRE_SCALE == 2
+#define FIRE_BITS 6                    // 63 levels / 0.75 per row: flames ~84 of 120 rows
+#else
+#define FIRE_BITS 7                    // 127 levels: ~170 of 240 rows
+#endif
+#define FIRE_MAX ((1 << FIRE_BITS) - 1)
+#define FIRE_LSB 0x01010101u
+static uint32_t* fireHeat = nullptr;         // (FIRE_H + 1) rows of FIRE_STRIDE words
+static int fireTop[FIRE_STRIPS];             // first row with heat, per strip
+static int fireDrawnTop[2][FIRE_STRIPS];     // per sprite: heat rows above this are black in it
+static int fireShownTop = 0;                 // sprite rows above this are black on screen
+
+// Clear rows [from, to); to == FIRE_H + 1 lights the fuel row
+static void initFire(int from, int to) {
+  size_t bytes = (FIRE_H + 1) * FIRE_STRIDE * sizeof(uint32_t);
+  if (!fireHeat) fireHeat = (uint32_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!fireHeat) fireHeat = (uint32_t*)ps_malloc(bytes);
+  if (!fireHeat) return;
+  memset(fireHeat + from * FIRE_STRIDE, 0, (to - from) * FIRE_STRIDE * sizeof(uint32_t));
+  if (to > FIRE_H) {
+    uint32_t* fuel = fireHeat + FIRE_H * FIRE_STRIDE;
+    for (int w = 1; w <= FIRE_WORDS; w++) fuel[w] = FIRE_MAX * FIRE_LSB;
+  }
+  for (int k = 0; k < FIRE_STRIPS; k++) {
+    fireTop[k] = FIRE_H;
+    fireDrawnTop[0][k] = fireDrawnTop[1][k] = FIRE_H;  // activateNextMode() clears both sprites
+  }
+  fireShownTop = 0;
+}
+
+// Step words [w0, w1) of every row, bottom-up, and map them through
+// firePalette into the sprite
+static void fireStepStrip(int w0, int w1, uint32_t seed, uint8_t* out) {
+  int strip = w0 / FIRE_STRIP_WORDS;
+  Prng rng;
+  prngSeed(rng, seed, strip);  // per strip, so results don't depend on which core ran it
+
+  int y = FIRE_H - 1;
+  for (; y >= 0; y--) {
+    const uint32_t* s = fireHeat + (y + 1) * FIRE_STRIDE + 1;
+    uint32_t* d = fireHeat + y * FIRE_STRIDE + 1;
+    // Little-endian: byte 0 is the leftmost cell. At an inner strip
+    // edge the neighbour word is replaced by the edge cell itself.
+    uint32_t prev = w0 == 0 ? 0 : s[w0] << 24;
+    uint32_t live = 0;
+    for (int i = w0; i < w1; i++) {
+      uint32_t cur = s[i];
+      uint32_t next = (i + 1 < w1 || w1 == FIRE_WORDS) ? s[i + 1] : cur >> 24;
+      uint32_t fromL = (cur << 8) | (prev >> 24);
+      uint32_t fromR = (cur >> 8) | (next << 24);
+      prev = cur;
+
+      uint32_t r = prngNext(rng);
+      uint32_t b0 = r & FIRE_LSB, b1 = (r >> 1) & FIRE_LSB;
+      uint32_t mL = (b0 & b1) * 0xFF;                   // 1/4 of cells
+      uint32_t mR = ((b0 | b1) ^ FIRE_LSB) * 0xFF;      // 1/4 of cells
+      uint32_t w = (fromL & mL) | (fromR & mR) | (cur & ~(mL | mR));
+      uint32_t t = (w | 0x80808080u) - (((r >> 2) | (r >> 3)) & FIRE_LSB);
+      w = t & (((t & 0x80808080u) >> 7) * 0x7F);
+      d[i] = w;
+      live |= w;
+    }
+    if (!live) break;
+
+    // Heat scaled up to 8 bits indexes the palette; no carries between bytes
+    uint8_t* row = out + y * FIRE_SCALE * SCR_W + w0 * 4 * FIRE_SCALE;
+    uint32_t* o = (uint32_t*)row;
+    for (int i = w0; i < w1; i++) {
+      uint32_t h = d[i] << (8 - FIRE_BITS);
+      uint32_t c0 = firePalette[h & 0xFF], c1 = firePalette[(h >> 8) & 0xFF];
+      uint32_t c2 = firePalette[(h >> 16) & 0xFF], c3 = firePalette[h >> 24];
+#if FIRE_SCALE == 2
+      *o++ = c0 | (c0 << 8) | (c1 << 16) | (c1 << 24);
+      *o++ = c2 | (c2 << 8) | (c3 << 16) | (c3 << 24);
+#else
+      *o++ = c0 | (c1 << 8) | (c2 << 16) | (c3 << 24);
+#endif
+    }
+#if FIRE_SCALE == 2
+    memcpy(row + SCR_W, row, (w1 - w0) * 8);
+#endif
+  }
+
+  // Row y came out empty, and with it everything above: clear what the
+  // last frame left there, in the heat field and in the sprite. The two
+  // sprites alternate, so this one last held the frame before that.
+  int top = y + 1;
+  for (int yy = fireTop[strip]; yy <= y; yy++) {
+    memset(fireHeat + yy * FIRE_STRIDE + 1 + w0, 0, (w1 - w0) * sizeof(uint32_t));
+  }
+  int& drawn = fireDrawnTop[_flip][strip];
+  for (int py = drawn * FIRE_SCALE; py < top * FIRE_SCALE; py++) {
+    memset(out + py * SCR_W + w0 * 4 * FIRE_SCALE, 0, (w1 - w0) * 4 * FIRE_SCALE);
+  }
+  drawn = top;
+  fireTop[strip] = top;
+}
+
+static void renderFire(uint8_t* buf) {
+  if (!fireHeat) return;
+  uint32_t seed = prngNext(rngFire);
+  jobsFor(FIRE_WORDS, [&](int w0, int w1) { fireStepStrip(w0, w1, seed, buf); },
+          FIRE_STRIP_WORDS);
+}
+
+// Rows above both this frame's and the last shown frame's fire are
+// black on screen already; push from the higher of the two
+static void pushFire(LGFX_Sprite& sp) {
+  int top = FIRE_H;
+  for (int k = 0; k < FIRE_STRIPS; k++) top = fireTop[k] < top ? fireTop[k] : top;
+  top *= FIRE_SCALE;
+  int y = top < fireShownTop ? top : fireShownTop;
+  fireShownTop = top;
+  if (y >= SCR_H) return;
+  lcd.pushImage(0, y, SCR_W, SCR_H - y, (uint8_t*)sp.getBuffer() + y * SCR_W);
+  lcd.display();
+}
+
+// ============================================================
+// MODE 8: Game of Life (bit-packed, SWAR)
+// ============================================================
+// One bit per cell, bit j of word i = column 32i + j, torus edges. A
+// generation adds up the 8 neighbour bitplanes of 32 cells at a time
+// with bit-sliced adders. Each cell also has a 3-bit counter, stored
+// as three more bitplanes: its age while alive, a countdown after it
+// dies. alive << 3 | counter indexes lifeColor, so newborns flash
+// white, settle into color, and leave a fading ghost.
+//
+// Words whose state changed are flagged per sprite, and only those
+// are expanded to RGB332. Generations run on a clock of their own
+// (LIFE_GENS_PER_SEC), several per frame if needed.
+#define LIFE_WORDS (SCR_W / 32)
+#define LIFE_GENS_PER_SEC 240
+#define LIFE_MAX_GENS 16               // per frame, caps catch-up after a slow frame
+#define LIFE_RESEED_GENS 512           // drop a fresh soup patch this often
+struct LifeBoard {
+  uint32_t alive[2][SCR_H][LIFE_WORDS];  // ping-pong
+  uint32_t age[3][SCR_H][LIFE_WORDS];    // counter bitplanes, updated in place
+};
+static LifeBoard* life = nullptr;
+static int lifeCur = 0;
+static uint16_t lifeDirty[2][SCR_H];   // per sprite: words (bit i) to redraw
+static uint32_t lifeGenDebt = 0;       // ms * LIFE_GENS_PER_SEC not yet run
+static uint32_t lifeLastMs = 0;
+static uint32_t lifeGens = 0;
+static int lifeFullFrames = 0;         // frames that must redraw every word
+static uint8_t lifeColor[16];
+
+static void lifeSoup(int y0, int rows, int w0, int words) {
+  for (int y = y0; y < y0 + rows; y++) {
+    for (int i = w0; i < w0 + words; i++) {
+      uint32_t r = prngNext(rngLife) & (prngNext(rngLife) | prngNext(rngLife));  // 3/8 density
+      int wy = y % SCR_H, wi = i % LIFE_WORDS;
+      life->alive[lifeCur][wy][wi] = r;
+      lifeDirty[0][wy] = lifeDirty[1][wy] = (1 << LIFE_WORDS) - 1;
+    }
+  }
+}
+
+// Board [from, to) rows — split so it can run across several frames
+static void initLife(int from, int to) {
+  if (!life) life = (LifeBoard*)heap_caps_malloc(sizeof(LifeBoard), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!life) life = (LifeBoard*)ps_malloc(sizeof(LifeBoard));
+  if (!life) return;
+  if (from == 0) {
+    lifeCur = 0;
+    lifeGens = 0;
+    lifeGenDebt = 0;
+    lifeLastMs = millis();
+    // Dead: a ghost fading out through fadeLUT. Alive: white, then the
+    // color ramp for ages 1..7.
+    static const uint8_t ageRamp[8] = { 0xFF, 0xDF, 0xBF, 0x9F, 0x7F, 0x5F, 0x3E, 0x3A };
+    uint8_t ghost = 0x4B;
+    for (int h = 7; h >= 1; h--) { lifeColor[h] = ghost; ghost = fadeLUT[fadeLUT[ghost]]; }
+    lifeColor[0] = 0;
+    for (int h = 0; h < 8; h++) lifeColor[8 + h] = ageRamp[h];
+  }
+  lifeSoup(from, to - from, 0, LIFE_WORDS);
+  for (int k = 0; k < 3; k++) memset(life->age[k][from], 0, (to - from) * sizeof(life->age[k][0]));
+}
+
+// One generation for rows [r0, r1): alive[lifeCur] -> alive[lifeCur ^ 1]
+static void lifeStepRows(int r0, int r1) {
+  uint32_t (*src)[LIFE_WORDS] = life->alive[lifeCur];
+  uint32_t (*dst)[LIFE_WORDS] = life->alive[lifeCur ^ 1];
+  for (int y = r0; y < r1; y++) {
+    const uint32_t* rows[3] = { src[(y + SCR_H - 1) % SCR_H], src[y], src[(y + 1) % SCR_H] };
+    uint16_t dirty = 0;
+    for (int i = 0; i < LIFE_WORDS; i++) {
+      int il = (i + LIFE_WORDS - 1) % LIFE_WORDS, ir = (i + 1) % LIFE_WORDS;
+      // Horizontal sums per row: 3 cells above/below, 2 beside
+      uint32_t s[3][2];
+      for (int k = 0; k < 3; k++) {
+        uint32_t c = rows[k][i];
+        uint32_t l = (c << 1) | (rows[k][il] >> 31);   // west neighbour at each bit
+        uint32_t r = (c >> 1) | (rows[k][ir] << 31);   // east neighbour
+        if (k == 1) { s[k][0] = l ^ r; s[k][1] = l & r; }
+        else        { s[k][0] = l ^ c ^ r; s[k][1] = (l & c) | (r & (l ^ c)); }
+      }
+      // count = ones + 2 * twos; 2 or 3 needs exactly one "two"
+      uint32_t ones = s[0][0] ^ s[1][0] ^ s[2][0];
+      uint32_t c0 = (s[0][0] & s[1][0]) | (s[2][0] & (s[0][0] ^ s[1][0]));
+      uint32_t p = s[0][1] ^ s[1][1], q = s[2][1] ^ c0;
+      uint32_t oneTwo = (p ^ q) & ~((s[0][1] & s[1][1]) | (s[2][1] & c0));
+      uint32_t a = rows[1][i];
+      uint32_t n = oneTwo & (ones | a);
+      dst[y][i] = n;
+
+      // Counter planes: stay alive -> age+1 (max 7), born -> 0,
+      // die -> 7, stay dead -> countdown (min 0)
+      uint32_t h0 = life->age[0][y][i], h1 = life->age[1][y][i], h2 = life->age[2][y][i];
+      uint32_t top = h0 & h1 & h2, zero = ~(h0 | h1 | h2);
+      uint32_t i0 = ~h0 | top, i1 = (h1 ^ h0) | top, i2 = h2 ^ (h1 & h0 & ~top);
+      uint32_t d0 = ~h0 & ~zero, d1 = (h1 ^ ~h0) & ~zero, d2 = h2 ^ (~h1 & ~h0 & ~zero);
+      uint32_t stay = a & n, died = a & ~n, dead = ~a & ~n;
+      uint32_t g0 = (i0 & stay) | died | (d0 & dead);
+      uint32_t g1 = (i1 & stay) | died | (d1 & dead);
+      uint32_t g2 = (i2 & stay) | died | (d2 & dead);
+      if ((g0 ^ h0) | (g1 ^ h1) | (g2 ^ h2) | (a ^ n)) dirty |= 1 << i;
+      life->age[0][y][i] = g0;
+      life->age[1][y][i] = g1;
+      life->age[2][y][i] = g2;
+    }
+    lifeDirty[0][y] |= dirty;
+    lifeDirty[1][y] |= dirty;
+  }
+}
+
+static void renderLife(uint8_t* buf) {
+  if (!life) return;
+
+  uint32_t now = millis();
+  lifeGenDebt += (now - lifeLastMs) * LIFE_GENS_PER_SEC;
+  lifeLastMs = now;
+  int gens = lifeGenDebt / 1000;
+  lifeGenDebt -= gens * 1000;
+  if (gens > LIFE_MAX_GENS) gens = LIFE_MAX_GENS;
+  for (int g = 0; g < gens; g++) {
+    jobsFor(SCR_H, [&](int r0, int r1) { lifeStepRows(r0, r1); });
+    lifeCur ^= 1;
+    if (++lifeGens % LIFE_RESEED_GENS == 0) {
+      lifeSoup(prngBelow(rngLife, SCR_H), 24, prngBelow(rngLife, LIFE_WORDS), 2);
+    }
+  }
+
+  // Fades rewrite the whole sprite, so redraw everything while one is
+  // running and for the two frames after (each sprite once)
+  if (transitioning) lifeFullFrames = 2;
+  bool full = lifeFullFrames > 0;
+  if (!transitioning && lifeFullFrames > 0) lifeFullFrames--;
+
+  const uint32_t (*alive)[LIFE_WORDS] = life->alive[lifeCur];
+  uint16_t* dirty = lifeDirty[_flip];
+  jobsFor(SCR_H, [&](int r0, int r1) {
+    for (int y = r0; y < r1; y++) {
+      uint16_t d = full ? (1 << LIFE_WORDS) - 1 : dirty[y];
+      dirty[y] = 0;
+      for (int i = 0; d; i++, d >>= 1) {
+        if (!(d & 1)) continue;
+        uint32_t a = alive[y][i];
+        uint32_t h0 = life->age[0][y][i], h1 = life->age[1][y][i], h2 = life->age[2][y][i];
+        uint32_t* out = (uint32_t*)(buf + y * SCR_W + i * 32);
+        for (int j = 0; j < 32; j += 4) {
+          uint32_t w = 0;
+          for (int k = 0; k < 4; k++) {
+            int b = j + k;
+            int idx = ((a >> b) & 1) << 3 | ((h2 >> b) & 1) << 2 | ((h1 >> b) & 1) << 1 | ((h0 >> b) & 1);
+            w |= (uint32_t)lifeColor[idx] << (8 * k);
+          }
+          *out++ = w;
+        }
+      }
+    }
+  });
+}
+
+// ============================================================
+// MODE 9: Mandelbrot zoom (Q4.28, progressive)
+// ============================================================
+// Coordinates are Q4.28 in an int32 (±8, 2^-28 steps); z^2 takes 64-bit
+// products and escapes once |z|^2 > 4. Every cell stores level << 8 |
+// iterations: level 0 is computed at its own point, level L (1..3) is
+// a copy of the anchor of the 2^L block it sits in, MAND_MISSING has
+// nothing yet. Iterations are 0 inside the set, else n + 1.
+//
+// Each frame zooms in a little. Pixel columns and rows of the new view
+// that land within 3/4 pixel of one from the last frame keep its cells
+// (XaoS-style: shift and scale by remapping whole rows and columns), so
+// only the rest, around 7% of the screen, needs work. Then refinement
+// passes run from 8x8 blocks down to single pixels, each over 40x40
+// tiles on both cores: compute any block anchor that isn't exact yet
+// and flood the block's coarser cells with it. The 8x8 pass always finishes, so
+// every frame is fully covered; finer passes stop when the governor's
+// render budget (the frame target minus the push, see govRenderBudget())
+// is used up, less MAND_COLOR_US for the colour pass, and pick up where
+// they left off next frame. The mode fills whatever time it gets, so it
+// has no knobs and stays at the top clock.
+#define MAND_TILE 40                   // multiple of the 8x8 coarse block
+#define MAND_TILES_X (SCR_W / MAND_TILE)
+#define MAND_TILES (MAND_TILES_X * (SCR_H / MAND_TILE))
+#define MAND_COARSE 3                  // first pass: 2^3 = 8x8 blocks
+#define MAND_MISSING (4 << 8)
+#define MAND_COLOR_US 2000             // render budget kept back for the colour pass
+#define MAND_ZOOM 252                  // step * 252/256 per frame, ~x2 every 44 frames
+#define MAND_START_STEP 2684355        // 3.2 / 320 per pixel, Q28
+#define MAND_MIN_STEP 256              // ~1e-6 per pixel; deeper runs out of Q28 bits
+#define MAND_Q(v) ((int32_t)((v) * 268435456.0))
+static uint16_t* mandCells[2] = { nullptr, nullptr };  // ping-pong, level << 8 | iter
+static int mandCur = 0;
+static int32_t mandRe[SCR_W], mandIm[SCR_H];  // coordinates of the current cells
+static int32_t mandStep = MAND_START_STEP;
+static int mandTarget = 0;
+static int mandMaxIter = 64;
+static uint8_t mandHue = 0;
+static std::atomic<uint32_t> mandFrameIters(0);
+#if ENABLE_PERF_LOG
+static uint64_t mandIterTotal = 0;
+static uint64_t mandIterUs = 0;
+#endif
+
+// Zoom targets, visited in turn; each is zoomed into until MAND_MIN_STEP
+static const int32_t mandTargets[][2] = {
+  { MAND_Q(-0.743643887037151), MAND_Q(0.131825904205330) },    // seahorse valley
+  { MAND_Q(-0.160701350),       MAND_Q(1.037566500) },
+  { MAND_Q(0.001643721971153),  MAND_Q(-0.822467633298876) },
+  { MAND_Q(-0.774680610626904), MAND_Q(-0.137416885603787) },
+  { MAND_Q(-1.250660000),       MAND_Q(0.020120000) },
+};
+#define MAND_NUM_TARGETS (int)(sizeof(mandTargets) / sizeof(mandTargets[0]))
+
+// Cells [from, to) rows — split so it can run across several frames
+static void initMandel(int from, int to) {
+  size_t bytes = SCR_W * SCR_H * sizeof(uint16_t);
+  for (int k = 0; k < 2; k++) {
+    if (!mandCells[k]) mandCells[k] = (uint16_t*)ps_malloc(bytes);
+    if (!mandCells[k]) return;
+  }
+  if (from == 0) {
+    mandStep = MAND_START_STEP;
+    mandCur = 0;
+    for (int x = 0; x < SCR_W; x++) mandRe[x] = INT32_MIN;  // nothing to reuse
+    for (int y = 0; y < SCR_H; y++) mandIm[y] = INT32_MIN;
+  }
+  for (int i = from * SCR_W; i < to * SCR_W; i++) mandCells[mandCur][i] = MAND_MISSING;
+}
+
+// Escape-time iteration count for c = cr + i*ci, 0 = inside
+static uint8_t mandIterate(int32_t cr, int32_t ci, int maxIter, uint32_t& count) {
+  // Main cardioid and period-2 bulb: inside, no need to iterate. Only
+  // tested near the set, where the products below stay in 64 bits.
+  if (cr > -MAND_Q(2.0) && cr < MAND_Q(0.5) && ci > -MAND_Q(1.0) && ci < MAND_Q(1.0)) {
+    int64_t y2 = ((int64_t)ci * ci) >> 28;
+    int64_t xq = cr - MAND_Q(0.25);
+    int64_t q = ((xq * xq) >> 28) + y2;
+    if (((q * (q + xq)) >> 28) <= (y2 >> 2)) return 0;
+    int64_t xb = cr + MAND_Q(1.0);
+    if (((xb * xb) >> 28) + y2 <= MAND_Q(0.0625)) return 0;
+  }
+  // |z| <= 2 before every step keeps x^2 - y^2 + cr and 2xy + ci in Q4.28
+  int32_t x = 0, y = 0;
+  int n = 0;
+  for (; n < maxIter; n++) {
+    int64_t xx = (int64_t)x * x, yy = (int64_t)y * y;
+    if (xx + yy > ((int64_t)4 << 56)) break;
+    int32_t xy = (int32_t)(((int64_t)x * y) >> 27);
+    x = (int32_t)((xx - yy) >> 28) + cr;
+    y = xy + ci;
+  }
+  count += n;
+  return n == maxIter ? 0 : (uint8_t)(n + 1);
+}
+
+// For each new coordinate, the nearest old index within tol of it that
+// the previous one didn't take, or -1. Both lists ascend (rows are
+// flipped by the caller), so one merge pass does it.
+static void mandMatch(const int32_t* oldC, const int32_t* newC, int n, int32_t tol, int16_t* src) {
+  int j = 0;
+  for (int i = 0; i < n; i++) {
+    while (j + 1 < n && oldC[j + 1] <= newC[i]) j++;
+    int best = -1;
+    int64_t bestD = (int64_t)tol + 1;
+    for (int k = j; k <= j + 1 && k < n; k++) {
+      int64_t d = (int64_t)oldC[k] - newC[i];
+      if (d < 0) d = -d;
+      if (d < bestD && (i == 0 || k != src[i - 1])) { bestD = d; best = k; }
+    }
+    src[i] = best;
+  }
+}
+
+// One refinement pass over tiles [t0, t1) at block size 2^level
+static void mandRefineTiles(int t0, int t1, int level, uint32_t deadline) {
+  uint16_t* cells = mandCells[mandCur];
+  int bs = 1 << level;
+  uint32_t count = 0;
+  bool late = false;
+  for (int t = t0; t < t1 && !late; t++) {
+    int tx = (t % MAND_TILES_X) * MAND_TILE, ty = (t / MAND_TILES_X) * MAND_TILE;
+    for (int by = ty; by < ty + MAND_TILE; by += bs) {
+      if (level < MAND_COARSE && (int32_t)(micros() - deadline) > 0) { late = true; break; }
+      for (int bx = tx; bx < tx + MAND_TILE; bx += bs) {
+        uint16_t& anchor = cells[by * SCR_W + bx];
+        if (anchor >> 8) anchor = mandIterate(mandRe[bx], mandIm[by], mandMaxIter, count);
+        if (!level) continue;
+        uint16_t fill = level << 8 | (anchor & 0xFF);
+        for (int y = by; y < by + bs; y++) {
+          uint16_t* c = cells + y * SCR_W + bx;
+          for (int x = 0; x < bs; x++) {
+            if ((c[x] >> 8) > level) c[x] = fill;
+          }
+        }
+      }
+    }
+  }
+  mandFrameIters.fetch_add(count, std::memory_order_relaxed);
+}
+
+static void renderMandel(uint8_t* buf) {
+  if (!mandCells[0] || !mandCells[1]) return;
+  uint32_t startUs = micros();
+
+  // Next view: zoom in on the target, or move on to the next one
+  int32_t step = (int32_t)(((int64_t)mandStep * MAND_ZOOM) >> 8);
+  if (step < MAND_MIN_STEP) {
+    mandTarget = (mandTarget + 1) % MAND_NUM_TARGETS;
+    step = MAND_START_STEP;
+  }
+  int depth = 0;
+  while ((MAND_START_STEP >> (depth + 1)) >= step) depth++;
+  int maxIter = 64 + 12 * depth;
+  if (maxIter > 250) maxIter = 250;
+  // More iterations: reused "inside" cells may escape now; keep showing
+  // them but queue them for refinement
+  uint16_t inside = maxIter > mandMaxIter ? 1 << 8 : 0;
+  mandMaxIter = maxIter;
+
+  // Remap last frame's rows and columns onto the new view. Imaginary
+  // coordinates fall down the screen, so rows are matched negated.
+  int32_t cr = mandTargets[mandTarget][0], ci = mandTargets[mandTarget][1];
+  int32_t newRe[SCR_W], newIm[SCR_H], oldIm[SCR_H], negIm[SCR_H];
+  int16_t colSrc[SCR_W], rowSrc[SCR_H];
+  for (int x = 0; x < SCR_W; x++) newRe[x] = cr + (x - SCR_W / 2) * step;
+  for (int y = 0; y < SCR_H; y++) {
+    newIm[y] = ci - (y - SCR_H / 2) * step;
+    negIm[y] = -newIm[y];
+    oldIm[y] = mandIm[y] == INT32_MIN ? INT32_MIN : -mandIm[y];
+  }
+  mandMatch(mandRe, newRe, SCR_W, step * 3 / 4, colSrc);
+  mandMatch(oldIm, negIm, SCR_H, step * 3 / 4, rowSrc);
+  // A reused row or column keeps the coordinate its cells were computed
+  // at, so it is never more than 3/4 pixel off and errors don't add up
+  for (int x = 0; x < SCR_W; x++) newRe[x] = colSrc[x] < 0 ? newRe[x] : mandRe[colSrc[x]];
+  for (int y = 0; y < SCR_H; y++) newIm[y] = rowSrc[y] < 0 ? newIm[y] : mandIm[rowSrc[y]];
+  memcpy(mandRe, newRe, sizeof(mandRe));
+  memcpy(mandIm, newIm, sizeof(mandIm));
+  mandStep = step;
+
+  const uint16_t* prev = mandCells[mandCur];
+  mandCur ^= 1;
+  uint16_t* cells = mandCells[mandCur];
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int y = y0; y < y1; y++) {
+      uint16_t* d = cells + y * SCR_W;
+      if (rowSrc[y] < 0) {
+        for (int x = 0; x < SCR_W; x++) d[x] = MAND_MISSING;
+        continue;
+      }
+      const uint16_t* s = prev + rowSrc[y] * SCR_W;
+      for (int x = 0; x < SCR_W; x++) {
+        uint16_t c = colSrc[x] < 0 ? MAND_MISSING : s[colSrc[x]];
+        d[x] = c ? c : inside;
+      }
+    }
+  });
+
+  // Refine coarse to fine; one tile per fetch, tiles vary a lot in cost
+  mandFrameIters.store(0, std::memory_order_relaxed);
+  uint32_t budget = govRenderBudget();
+  uint32_t deadline = startUs + (budget > MAND_COLOR_US ? budget - MAND_COLOR_US : 0);
+  for (int level = MAND_COARSE; level >= 0; level--) {
+    jobsFor(MAND_TILES, [&](int t0, int t1) { mandRefineTiles(t0, t1, level, deadline); }, 1);
+  }
+#if ENABLE_PERF_LOG
+  mandIterTotal += mandFrameIters.load(std::memory_order_relaxed);
+  mandIterUs += micros() - startUs;
+#endif
+
+  // Slowly cycling hue wheel; the set itself is black
+  mandHue++;
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int i = y0 * SCR_W; i < y1 * SCR_W; i++) {
+      uint8_t it = cells[i] & 0xFF;
+      buf[i] = it ? fmHue332[(uint8_t)(it * 6 + mandHue)] : 0;
+    }
+  });
+}
+
+#if ENABLE_PERF_LOG
+// Iterations per second of refinement time, since the last report
+static void mandReport() {
+  uint32_t rate = mandIterUs ? (uint32_t)(mandIterTotal * 1000000 / mandIterUs) : 0;
+  Serial.printf("mandel: %lu iter/s\n", (unsigned long)rate);
+  mandIterTotal = 0;
+  mandIterUs = 0;
+}
+#endif
+
+// ============================================================
+// MODE 10: Polyhedra (Q16.16, flat-shaded)
+// ============================================================
+// A torus with a spiky geodesic ball orbiting it. Vertices are Q16.16
+// and go through a Q16.16 rotation built from fmSin/fmCos, then a
+// perspective divide by fmRecip. Faces turned away from the camera are
+// dropped, the rest get one shade each from a directional light, are
+// radix-sorted far to near on their depth sum (painter's algorithm) and
+// filled by a scanline rasterizer that memsets RGB332 spans. Both cores
+// rasterize, each into its half of the rows the scene covers.
+//
+// Only the scene's screen bounds are cleared, drawn and pushed: each
+// sprite remembers the rectangle it last drew into, and the push covers
+// the new rectangle plus the one on screen.
+#define POLY_MAX_VERTS 512
+#define POLY_MAX_TRIS 800
+#define POLY_TORUS_MAJOR 24
+#define POLY_TORUS_MINOR 12            // 2 * 24 * 12 = 576 triangles
+#define POLY_GEO_FREQ 3                // icosahedron faces split 3x3: 180 triangles
+#define POLY_FOCAL 150                 // px per unit at distance 1
+#define POLY_SHADES 32
+#define POLY_AMBIENT 5                 // darkest shade a lit-away face gets
+typedef Fixed<16> Q16;                 // Q16.16
+struct PolyVec { Q16 x, y, z; };
+struct PolyObject {
+  int v0, v1, t0, t1;                  // vertex and triangle ranges
+  uint16_t ang[3];                     // about x, y, z (binary angles)
+  int16_t spin[3];                     // per frame
+  uint8_t shade[POLY_SHADES];          // RGB332, dark to lit
+};
+struct PolyScene {
+  PolyVec model[POLY_MAX_VERTS];
+  PolyVec view[POLY_MAX_VERTS];        // camera space, +z into the screen
+  int32_t sx[POLY_MAX_VERTS], sy[POLY_MAX_VERTS];  // screen, Q16.16 px
+  uint16_t tri[POLY_MAX_TRIS][3];
+  PolyVec normal[POLY_MAX_TRIS];       // model space, unit length
+  uint8_t color[POLY_MAX_TRIS];        // this frame's shade
+  uint32_t order[2][POLY_MAX_TRIS];    // far-to-near key << 16 | triangle, and sort scratch
+};
+struct PolyRect { int x0, y0, x1, y1; };  // [x0, x1) x [y0, y1), empty if x0 >= x1
+static PolyScene* poly = nullptr;
+static PolyObject polyObj[2];          // torus, ball
+static int polyVerts = 0, polyTris = 0;
+static int polyDrawn = 0;              // triangles painted this frame
+static uint16_t polyOrbit = 0;
+static PolyRect polyRect[2];           // per sprite: area drawn last time
+static PolyRect polyShown;             // area the screen may show non-black
+static const PolyVec polyLight = {     // towards the light: upper left, in front
+  Q16::fromFloat(-0.45f), Q16::fromFloat(0.55f), Q16::fromFloat(-0.70f)
+};
+static const Q16 polyCamZ = Q16::fromFloat(4.4f);
+#if ENABLE_PERF_LOG
+static uint64_t polyTriTotal = 0;
+static uint64_t polyTriUs = 0;
+#endif
+
+static int polyAddVert(float x, float y, float z) {
+  PolyVec& v = poly->model[polyVerts];
+  v.x = Q16::fromFloat(x);
+  v.y = Q16::fromFloat(y);
+  v.z = Q16::fromFloat(z);
+  return polyVerts++;
+}
+
+// Triangle a, b, c with its normal pointing away from the ring of
+// radius ringR around the z axis (0: away from the origin)
+static void polyAddTri(int a, int b, int c, float ringR) {
+  const PolyVec* m = poly->model;
+  float ax = m[a].x.toFloat(), ay = m[a].y.toFloat(), az = m[a].z.toFloat();
+  float ux = m[b].x.toFloat() - ax, uy = m[b].y.toFloat() - ay, uz = m[b].z.toFloat() - az;
+  float vx = m[c].x.toFloat() - ax, vy = m[c].y.toFloat() - ay, vz = m[c].z.toFloat() - az;
+  float nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+  float cx = ax + (ux + vx) / 3, cy = ay + (uy + vy) / 3, cz = az + (uz + vz) / 3;
+  float rl = sqrtf(cx * cx + cy * cy);
+  if (ringR > 0 && rl > 0) { cx -= cx * ringR / rl; cy -= cy * ringR / rl; }
+  float len = sqrtf(nx * nx + ny * ny + nz * nz);
+  if (nx * cx + ny * cy + nz * cz < 0) len = -len;
+  uint16_t* t = poly->tri[polyTris];
+  t[0] = a; t[1] = b; t[2] = c;
+  PolyVec& n = poly->normal[polyTris++];
+  n.x = Q16::fromFloat(nx / len);
+  n.y = Q16::fromFloat(ny / len);
+  n.z = Q16::fromFloat(nz / len);
+}
+
+static void polyBuildTorus(float R, float r) {
+  int base = polyVerts;
+  for (int i = 0; i < POLY_TORUS_MAJOR; i++) {
+    float a = i * 6.2831853f / POLY_TORUS_MAJOR;
+    for (int j = 0; j < POLY_TORUS_MINOR; j++) {
+      float b = j * 6.2831853f / POLY_TORUS_MINOR;
+      float d = R + r * cosf(b);
+      polyAddVert(d * cosf(a), d * sinf(a), r * sinf(b));
+    }
+  }
+  for (int i = 0; i < POLY_TORUS_MAJOR; i++) {
+    int i1 = (i + 1) % POLY_TORUS_MAJOR;
+    for (int j = 0; j < POLY_TORUS_MINOR; j++) {
+      int j1 = (j + 1) % POLY_TORUS_MINOR;
+      int v00 = base + i * POLY_TORUS_MINOR + j, v01 = base + i * POLY_TORUS_MINOR + j1;
+      int v10 = base + i1 * POLY_TORUS_MINOR + j, v11 = base + i1 * POLY_TORUS_MINOR + j1;
+      polyAddTri(v00, v10, v11, R);
+      polyAddTri(v00, v11, v01, R);
+    }
+  }
+}
+
+// Geodesic sphere: every icosahedron face split into POLY_GEO_FREQ^2
+// triangles, points pushed out to radius r and the 12 original corners
+// further, to `spike`. Edge points are repeated per face; flat shading
+// never shares them.
+static void polyBuildGeodesic(float r, float spike) {
+  static const int8_t ico[12][3] = {
+    {-1, 2, 0}, {1, 2, 0}, {-1, -2, 0}, {1, -2, 0}, {0, -1, 2}, {0, 1, 2},
+    {0, -1, -2}, {0, 1, -2}, {2, 0, -1}, {2, 0, 1}, {-2, 0, -1}, {-2, 0, 1}
+  };  // 2 stands for the golden ratio
+  static const uint8_t faces[20][3] = {
+    {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11}, {1, 5, 9}, {5, 11, 4},
+    {11, 10, 2}, {10, 7, 6}, {7, 1, 8}, {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8},
+    {3, 8, 9}, {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+  };
+  const int F = POLY_GEO_FREQ;
+  for (int f = 0; f < 20; f++) {
+    float c[3][3];
+    for (int k = 0; k < 3; k++) {
+      for (int a = 0; a < 3; a++) {
+        int8_t v = ico[faces[f][k]][a];
+        c[k][a] = v == 2 ? 1.618034f : v == -2 ? -1.618034f : v;
+      }
+    }
+    int idx[F + 1][F + 1];
+    for (int i = 0; i <= F; i++) {
+      for (int j = 0; i + j <= F; j++) {
+        float p[3];
+        for (int a = 0; a < 3; a++) p[a] = (c[0][a] * (F - i - j) + c[1][a] * i + c[2][a] * j) / F;
+        bool corner = i == F || j == F || i + j == 0;
+        float s = (corner ? spike : r) / sqrtf(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        idx[i][j] = polyAddVert(p[0] * s, p[1] * s, p[2] * s);
+      }
+    }
+    for (int i = 0; i < F; i++) {
+      for (int j = 0; i + j < F; j++) {
+        polyAddTri(idx[i][j], idx[i + 1][j], idx[i][j + 1], 0);
+        if (i + j + 2 <= F) polyAddTri(idx[i + 1][j], idx[i + 1][j + 1], idx[i][j + 1], 0);
+      }
+    }
+  }
+}
+
+static void polySetup(PolyObject& o, uint8_t r, uint8_t g, uint8_t b) {
+  for (int a = 0; a < 3; a++) {
+    o.ang[a] = prngNext(rngPoly);
+    o.spin[a] = prngRange(rngPoly, 120, 480) * (prngBelow(rngPoly, 2) ? 1 : -1);
+  }
+  for (int k = 0; k < POLY_SHADES; k++) {
+    o.shade[k] = rgb332(r * k / (POLY_SHADES - 1), g * k / (POLY_SHADES - 1), b * k / (POLY_SHADES - 1));
+  }
+}
+
+static void initPoly() {
+  if (!poly) poly = (PolyScene*)heap_caps_malloc(sizeof(PolyScene), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!poly) poly = (PolyScene*)ps_malloc(sizeof(PolyScene));
+  if (!poly) return;
+  if (!polyVerts) {
+    polyObj[0].v0 = polyVerts; polyObj[0].t0 = polyTris;
+    polyBuildTorus(1.15f, 0.42f);
+    polyObj[0].v1 = polyVerts; polyObj[0].t1 = polyTris;
+    polyObj[1].v0 = polyVerts; polyObj[1].t0 = polyTris;
+    polyBuildGeodesic(0.5f, 0.8f);
+    polyObj[1].v1 = polyVerts; polyObj[1].t1 = polyTris;
+  }
+  static const uint8_t colors[][3] = {
+    { 255, 96, 32 }, { 96, 224, 255 }, { 255, 224, 64 }, { 128, 255, 96 }, { 255, 96, 224 }
+  };
+  int c = prngBelow(rngPoly, 5);
+  polySetup(polyObj[0], colors[c][0], colors[c][1], colors[c][2]);
+  c = (c + 1 + prngBelow(rngPoly, 4)) % 5;
+  polySetup(polyObj[1], colors[c][0], colors[c][1], colors[c][2]);
+  polyOrbit = prngNext(rngPoly);
+  polyRect[0] = polyRect[1] = polyShown = PolyRect{ 0, 0, 0, 0 };
+}
+
+// R = Rz * Ry * Rx, Q15 sin/cos widened to Q16
+static void polyRotation(const uint16_t* ang, Q16 m[3][3]) {
+  Q16 sx = Q16::fromRaw(fmSin(ang[0]) * 2), cx = Q16::fromRaw(fmCos(ang[0]) * 2);
+  Q16 sy = Q16::fromRaw(fmSin(ang[1]) * 2), cy = Q16::fromRaw(fmCos(ang[1]) * 2);
+  Q16 sz = Q16::fromRaw(fmSin(ang[2]) * 2), cz = Q16::fromRaw(fmCos(ang[2]) * 2);
+  m[0][0] = cz * cy; m[0][1] = cz * sy * sx - sz * cx; m[0][2] = cz * sy * cx + sz * sx;
+  m[1][0] = sz * cy; m[1][1] = sz * sy * sx + cz * cx; m[1][2] = sz * sy * cx - cz * sx;
+  m[2][0] = -sy;     m[2][1] = cy * sx;                m[2][2] = cy * cx;
+}
+
+static inline PolyVec polyMul(const Q16 m[3][3], const PolyVec& v) {
+  return PolyVec{ m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                  m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                  m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z };
+}
+
+// dx per row of the edge a -> b, Q16.16
+static inline int32_t polySlope(int32_t ax, int32_t ay, int32_t bx, int32_t by) {
+  int32_t dy = by - ay;
+  return dy > 0 ? (int32_t)(((int64_t)(bx - ax) << 16) / dy) : 0;
+}
+
+// Edge x at the center of pixel row y
+static inline int32_t polyEdgeAt(int32_t ax, int32_t ay, int32_t slope, int y) {
+  return ax + (int32_t)(((int64_t)((y << 16) + 0x8000 - ay) * slope) >> 16);
+}
+
+// Fill rows [yLo, yHi) of a triangle in Q16.16 screen coordinates.
+// A pixel is inside when its center is, left and top edges inclusive,
+// so triangles sharing an edge never overlap or leave a gap.
+static void polyFillTri(uint8_t* buf, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                        int32_t x2, int32_t y2, uint8_t color, int yLo, int yHi) {
+  int32_t t;
+  if (y1 < y0) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+  if (y2 < y0) { t = x0; x0 = x2; x2 = t; t = y0; y0 = y2; y2 = t; }
+  if (y2 < y1) { t = x1; x1 = x2; x2 = t; t = y1; y1 = y2; y2 = t; }
+  int ys = (y0 + 0x7FFF) >> 16, ym = (y1 + 0x7FFF) >> 16, ye = (y2 + 0x7FFF) >> 16;
+  if (ys < yLo) ys = yLo;
+  if (ye > yHi) ye = yHi;
+  if (ys >= ye) return;
+
+  int32_t sLong = polySlope(x0, y0, x2, y2);
+  for (int half = 0; half < 2; half++) {
+    int from = half ? (ym > ys ? ym : ys) : ys;
+    int to = half ? ye : (ym < ye ? ym : ye);
+    if (from >= to) continue;
+    int32_t ax = half ? x1 : x0, ay = half ? y1 : y0;
+    int32_t s = half ? polySlope(x1, y1, x2, y2) : polySlope(x0, y0, x1, y1);
+    int32_t xa = polyEdgeAt(ax, ay, s, from), xb = polyEdgeAt(x0, y0, sLong, from);
+    uint8_t* row = buf + from * SCR_W;
+    for (int y = from; y < to; y++, xa += s, xb += sLong, row += SCR_W) {
+      int l = ((xa < xb ? xa : xb) + 0x7FFF) >> 16;
+      int r = ((xa < xb ? xb : xa) + 0x7FFF) >> 16;
+      if (l < 0) l = 0;
+      if (r > SCR_W) r = SCR_W;
+      if (l < r) memset(row + l, color, r - l);
+    }
+  }
+}
+
+// Stable LSD radix sort on the top 16 bits, two byte passes
+static void polySort(uint32_t* keys, uint32_t* tmp, int n) {
+  for (int shift = 16; shift < 32; shift += 8) {
+    int count[257] = { 0 };
+    for (int i = 0; i < n; i++) count[((keys[i] >> shift) & 0xFF) + 1]++;
+    for (int b = 0; b < 256; b++) count[b + 1] += count[b];
+    for (int i = 0; i < n; i++) tmp[count[(keys[i] >> shift) & 0xFF]++] = keys[i];
+    uint32_t* s = keys; keys = tmp; tmp = s;
+  }
+}
+
+static void renderPoly(uint8_t* buf) {
+  if (!poly) return;
+#if ENABLE_PERF_LOG
+  uint32_t startUs = micros();
+#endif
+
+  // Erase what this sprite drew two frames ago
+  PolyRect& rect = polyRect[_flip];
+  for (int y = rect.y0; y < rect.y1; y++) memset(buf + y * SCR_W + rect.x0, 0, rect.x1 - rect.x0);
+
+  // Torus at the origin, ball on a tilted orbit around it
+  polyOrbit += 170;
+  PolyVec pos[2] = {
+    { Q16(), Q16(), Q16() },
+    { Q16::fromRaw(fmCos(polyOrbit) * 4), Q16::fromRaw(fmSin(polyOrbit)),
+      Q16::fromRaw(fmSin(polyOrbit) * 4) },  // radius 2 (Q15 * 4 = Q16 * 2), y +-0.5
+  };
+  int xMin = INT32_MAX, xMax = INT32_MIN, yMin = INT32_MAX, yMax = INT32_MIN;
+  int n = 0;
+  uint32_t* order = poly->order[0];
+  for (int k = 0; k < 2; k++) {
+    PolyObject& o = polyObj[k];
+    for (int a = 0; a < 3; a++) o.ang[a] += o.spin[a];
+    Q16 m[3][3];
+    polyRotation(o.ang, m);
+
+    for (int i = o.v0; i < o.v1; i++) {
+      PolyVec v = polyMul(m, poly->model[i]);
+      v.x += pos[k].x;
+      v.y += pos[k].y;
+      v.z += pos[k].z + polyCamZ;
+      poly->view[i] = v;
+      // fmRecip(z) = 2^32 / z = 1/z in Q16; y is up in view space
+      int64_t iz = (int64_t)fmRecip(v.z.raw) * POLY_FOCAL;
+      int32_t sx = (SCR_W / 2 << 16) + (int32_t)((v.x.raw * iz) >> 16);
+      int32_t sy = (SCR_H / 2 << 16) - (int32_t)((v.y.raw * iz) >> 16);
+      poly->sx[i] = sx;
+      poly->sy[i] = sy;
+      if (sx < xMin) xMin = sx;
+      if (sx > xMax) xMax = sx;
+      if (sy < yMin) yMin = sy;
+      if (sy > yMax) yMax = sy;
+    }
+
+    // Cull, shade and queue the faces that point at the camera
+    for (int t = o.t0; t < o.t1; t++) {
+      const uint16_t* tv = poly->tri[t];
+      PolyVec nv = polyMul(m, poly->normal[t]);
+      const PolyVec &a = poly->view[tv[0]], &b = poly->view[tv[1]], &c = poly->view[tv[2]];
+      Q16 cx = a.x + b.x + c.x, cy = a.y + b.y + c.y, cz = a.z + b.z + c.z;  // 3x centroid
+      if ((nv.x * cx + nv.y * cy + nv.z * cz).raw >= 0) continue;
+      int32_t lit = (nv.x * polyLight.x + nv.y * polyLight.y + nv.z * polyLight.z).raw;
+      int shade = POLY_AMBIENT + (lit > 0 ? (int)(((int64_t)lit * (POLY_SHADES - 1 - POLY_AMBIENT)) >> 16) : 0);
+      poly->color[t] = o.shade[shade < POLY_SHADES ? shade : POLY_SHADES - 1];
+      uint32_t depth = (uint32_t)cz.raw >> 5;  // < 2^16 while the scene stays within z < 10
+      order[n++] = (0xFFFF - depth) << 16 | t;
+    }
+  }
+  polySort(order, poly->order[1], n);
+  polyDrawn = n;
+
+  // This frame's bounds, whole pixels, on screen
+  PolyRect r = { xMin >> 16, yMin >> 16, (xMax >> 16) + 2, (yMax >> 16) + 2 };
+  if (r.x0 < 0) r.x0 = 0;
+  if (r.y0 < 0) r.y0 = 0;
+  if (r.x1 > SCR_W) r.x1 = SCR_W;
+  if (r.y1 > SCR_H) r.y1 = SCR_H;
+  if (r.x0 >= r.x1 || r.y0 >= r.y1) r = PolyRect{ 0, 0, 0, 0 };
+  rect = r;
+
+  // Paint back to front; each core takes half of the rows
+  int h = r.y1 - r.y0;
+  jobsFor(h, [&](int b, int e) {
+    for (int i = 0; i < n; i++) {
+      int t = order[i] & 0xFFFF;
+      const uint16_t* tv = poly->tri[t];
+      polyFillTri(buf, poly->sx[tv[0]], poly->sy[tv[0]], poly->sx[tv[1]], poly->sy[tv[1]],
+                  poly->sx[tv[2]], poly->sy[tv[2]], poly->color[t], r.y0 + b, r.y0 + e);
+    }
+  }, (h + 1) / 2);
+
+#if ENABLE_PERF_LOG
+  polyTriTotal += n;
+  polyTriUs += micros() - startUs;
+#endif
+}
+
+// Push one rectangle of the sprite as a single transfer: the clip rect
+// lets pushSprite() send it with one address window
+static void pushSpriteRect(LGFX_Sprite& sp, int x, int y, int w, int h) {
+  lcd.setClipRect(x, y, w, h);
+  sp.pushSprite(&lcd, 0, 0);
+  lcd.clearClipRect();
+}
+
+// Push this frame's bounds plus what's on screen; fades touch every
+// pixel, so push everything while one runs
+static void pushPoly(LGFX_Sprite& sp) {
+  const PolyRect& now = polyRect[_flip];
+  if (transitioning) {
+    sp.pushSprite(&lcd, 0, 0);
+    polyShown = now;
+    return;
+  }
+  PolyRect u = polyShown;
+  if (now.x0 < now.x1) {
+    if (u.x0 >= u.x1) u = now;
+    if (now.x0 < u.x0) u.x0 = now.x0;
+    if (now.y0 < u.y0) u.y0 = now.y0;
+    if (now.x1 > u.x1) u.x1 = now.x1;
+    if (now.y1 > u.y1) u.y1 = now.y1;
+  }
+  polyShown = now;
+  if (u.x0 >= u.x1) return;
+  pushSpriteRect(sp, u.x0, u.y0, u.x1 - u.x0, u.y1 - u.y0);
+  lcd.display();
+}
+
+#if ENABLE_PERF_LOG
+// Painted triangles per second of render time, since the last report
+static void polyReport() {
+  uint32_t rate = polyTriUs ? (uint32_t)(polyTriTotal * 1000000 / polyTriUs) : 0;
+  Serial.printf("poly: %lu tri/s, %d tri/frame\n", (unsigned long)rate, polyDrawn);
+  polyTriTotal = 0;
+  polyTriUs = 0;
+}
+#endif
+
+// ============================================================
+// MODE 11: 3D Maze (fixed-point raycaster)
+// ============================================================
+// Homage to the Windows 3D Maze: a random maze walked with the
+// right-hand rule, one ray per screen column. Positions are Q16.16
+// tiles, ray directions Q15 from fmCos/fmSin, and each ray's angle
+// offset and fisheye cosine come from per-column tables. The DDA steps
+// tile edges with |1/dx| and |1/dy| from fmRecip, the wall slice is
+// textured from mazeAtlas (gen_maze_textures.py, column-major, with a
+// dimmed copy for y-side hits), and ceiling and floor are one memset
+// per row from a distance-shaded color table. Each core takes bands of
+// columns.
+#define MAZE_CELLS 10                  // maze is MAZE_CELLS^2 cells
+#define MAZE_N (2 * MAZE_CELLS + 1)    // map tiles per side, walls included
+#define MAZE_FOCAL 246                 // px; ~66 degree field of view
+#define MAZE_MOVE_STEP 5461            // Q16 tiles per frame: 12 frames per tile
+#define MAZE_TURN_STEP 2048            // binary angle per frame: 8 frames per turn
+static uint8_t mazeMap[MAZE_N][MAZE_N];  // 0 = open, else wall texture + 1
+static int16_t mazeColAngle[SCR_W];    // ray angle offset per column
+static int16_t mazeColCos[SCR_W];      // its cosine, Q15 (fisheye correction)
+static uint8_t mazeRowColor[SCR_H];    // ceiling and floor, darker toward the horizon
+static int mazeCols = SCR_W;           // governed: rays per frame, SCR_W or SCR_W / 2
+static int32_t mazePosX, mazePosY;     // Q16.16 tiles
+static uint16_t mazeAngle;             // binary angle, 0 = +x, 16384 = +y
+static int mazeTileX, mazeTileY, mazeDir;  // tile being walked to, facing 0..3
+static uint16_t mazeTurnTo;
+static bool mazeTurning = false, mazeMustMove = false;
+
+// Recursive backtracker, iterative; walls keep the texture they're given
+static void mazeGenerate() {
+  uint8_t wall = 1 + (prngBelow(rngMaze, 2) ? 0 : 2);  // brick or wood inside
+  for (int y = 0; y < MAZE_N; y++) {
+    for (int x = 0; x < MAZE_N; x++) {
+      bool border = x == 0 || y == 0 || x == MAZE_N - 1 || y == MAZE_N - 1;
+      mazeMap[y][x] = border ? 2 : wall;
+    }
+  }
+  static const int8_t dx[4] = { 1, 0, -1, 0 }, dy[4] = { 0, 1, 0, -1 };
+  uint8_t stack[MAZE_CELLS * MAZE_CELLS];
+  int sp = 0;
+  stack[sp++] = 0;
+  mazeMap[1][1] = 0;
+  while (sp) {
+    int c = stack[sp - 1], cx = c % MAZE_CELLS, cy = c / MAZE_CELLS;
+    int open[4], n = 0;
+    for (int d = 0; d < 4; d++) {
+      int nx = cx + dx[d], ny = cy + dy[d];
+      if (nx >= 0 && ny >= 0 && nx < MAZE_CELLS && ny < MAZE_CELLS && mazeMap[2 * ny + 1][2 * nx + 1]) open[n++] = d;
+    }
+    if (!n) { sp--; continue; }
+    int d = open[prngBelow(rngMaze, n)];
+    mazeMap[2 * cy + 1 + dy[d]][2 * cx + 1 + dx[d]] = 0;
+    mazeMap[2 * (cy + dy[d]) + 1][2 * (cx + dx[d]) + 1] = 0;
+    stack[sp++] = (cy + dy[d]) * MAZE_CELLS + cx + dx[d];
+  }
+  // Flag the walls around the goal in the far corner
+  mazeMap[MAZE_N - 1][MAZE_N - 2] = mazeMap[MAZE_N - 2][MAZE_N - 1] = 4;
+
+  mazeTileX = mazeTileY = 1;
+  mazePosX = mazePosY = (1 << 16) + 0x8000;  // tile centers
+  mazeDir = mazeMap[1][2] ? 1 : 0;
+  mazeAngle = mazeTurnTo = mazeDir * 16384;
+  mazeTurning = mazeMustMove = false;
+}
+
+static void initMaze() {
+  for (int x = 0; x < SCR_W; x++) {
+    uint16_t a = fmAtan2(2 * x + 1 - SCR_W, 2 * MAZE_FOCAL);
+    mazeColAngle[x] = (int16_t)a;
+    mazeColCos[x] = fmCos(a);
+  }
+  // Ceiling and floor: one fadeLUT step per tile of distance
+  for (int y = 0; y < SCR_H; y++) {
+    int dy = y < SCR_H / 2 ? SCR_H / 2 - y : y - SCR_H / 2 + 1;
+    int dist = MAZE_FOCAL / (2 * dy);   // tiles to where this row meets the plane
+    uint8_t c = y < SCR_H / 2 ? rgb332(120, 120, 150) : rgb332(110, 80, 50);
+    for (int k = 0; k < dist && k < 12; k++) c = fadeLUT[c];
+    mazeRowColor[y] = c;
+  }
+  mazeGenerate();
+}
+
+// One step of the right-hand rule: turn toward the right wall's opening,
+// else go straight, else turn left; a turn to the right is always
+// followed by a move
+static void mazeWalk() {
+  static const int8_t dx[4] = { 1, 0, -1, 0 }, dy[4] = { 0, 1, 0, -1 };
+  if (mazeTurning) {
+    int16_t left = (int16_t)(mazeTurnTo - mazeAngle);
+    if (left > MAZE_TURN_STEP) mazeAngle += MAZE_TURN_STEP;
+    else if (left < -MAZE_TURN_STEP) mazeAngle -= MAZE_TURN_STEP;
+    else { mazeAngle = mazeTurnTo; mazeTurning = false; }
+    return;
+  }
+  int32_t tx = (mazeTileX << 16) + 0x8000, ty = (mazeTileY << 16) + 0x8000;
+  if (mazePosX != tx || mazePosY != ty) {
+    int32_t ex = tx - mazePosX, ey = ty - mazePosY;
+    mazePosX += ex > MAZE_MOVE_STEP ? MAZE_MOVE_STEP : ex < -MAZE_MOVE_STEP ? -MAZE_MOVE_STEP : ex;
+    mazePosY += ey > MAZE_MOVE_STEP ? MAZE_MOVE_STEP : ey < -MAZE_MOVE_STEP ? -MAZE_MOVE_STEP : ey;
+    return;
+  }
+  if (mazeTileX == MAZE_N - 2 && mazeTileY == MAZE_N - 2) {
+    mazeGenerate();
+    return;
+  }
+  int right = (mazeDir + 1) & 3;
+  if (!mazeMustMove && !mazeMap[mazeTileY + dy[right]][mazeTileX + dx[right]]) {
+    mazeDir = right;
+    mazeTurnTo += 16384;
+    mazeTurning = mazeMustMove = true;
+  } else if (!mazeMap[mazeTileY + dy[mazeDir]][mazeTileX + dx[mazeDir]]) {
+    mazeTileX += dx[mazeDir];
+    mazeTileY += dy[mazeDir];
+    mazeMustMove = false;
+  } else {
+    mazeDir = (mazeDir + 3) & 3;
+    mazeTurnTo -= 16384;
+    mazeTurning = true;
+    mazeMustMove = false;
+  }
+}
+
+// Cast and draw screen columns [x0, x1), one ray per wide columns
+static void mazeColumns(uint8_t* buf, int x0, int x1, int wide) {
+  int32_t px = mazePosX, py = mazePosY;
+  for (int x = x0; x < x1; x += wide) {
+    uint16_t a = mazeAngle + mazeColAngle[x];
+    int32_t rx = fmCos(a), ry = fmSin(a);  // Q15
+    // fmRecip(|r|) = 2^32 / (|r| * 2^15): |1/r| in Q17, halved to Q16
+    uint32_t ddx = fmRecip(rx < 0 ? -rx : rx) >> 1, ddy = fmRecip(ry < 0 ? -ry : ry) >> 1;
+    int stepX = rx < 0 ? -1 : 1, stepY = ry < 0 ? -1 : 1;
+    uint32_t fx = rx < 0 ? (px & 0xFFFF) : 0x10000 - (px & 0xFFFF);
+    uint32_t fy = ry < 0 ? (py & 0xFFFF) : 0x10000 - (py & 0xFFFF);
+    uint32_t sideX = (uint32_t)(((uint64_t)fx * ddx) >> 16), sideY = (uint32_t)(((uint64_t)fy * ddy) >> 16);
+    int mx = px >> 16, my = py >> 16, side, tile;
+    uint32_t dist;
+    for (;;) {  // the border is solid, so every ray ends
+      if (sideX < sideY) { mx += stepX; dist = sideX; sideX += ddx; side = 0; }
+      else               { my += stepY; dist = sideY; sideY += ddy; side = 1; }
+      if ((tile = mazeMap[my][mx])) break;
+    }
+
+    // Where along the wall it hit, mirrored so textures read the same
+    // from both sides
+    int32_t along = side ? px + (int32_t)(((int64_t)dist * rx) >> 15) : py + (int32_t)(((int64_t)dist * ry) >> 15);
+    int tx = (along >> 10) & (MAZE_TEX - 1);
+    if ((side == 0 && rx > 0) || (side == 1 && ry < 0)) tx = MAZE_TEX - 1 - tx;
+    const uint8_t* col = mazeAtlas[tile - 1 + side * MAZE_TEXTURES] + tx * MAZE_TEX;
+
+    // Perpendicular distance sets the height; Q16 texels per pixel
+    uint32_t perp = (uint32_t)(((uint64_t)dist * mazeColCos[x]) >> 15);
+    if (perp < 0x400) perp = 0x400;
+    int h = (int)(((uint64_t)MAZE_FOCAL * fmRecip(perp)) >> 16);
+    uint32_t step = perp * MAZE_TEX / MAZE_FOCAL;
+    int y0 = SCR_H / 2 - h / 2, y1 = SCR_H / 2 + h / 2;
+    if (y0 < 0) y0 = 0;
+    if (y1 > SCR_H) y1 = SCR_H;
+    uint32_t v = (MAZE_TEX / 2 << 16) + (y0 - SCR_H / 2) * (int32_t)step + step / 2;
+    uint8_t* out = buf + y0 * SCR_W + x;
+    if (wide == 1) {
+      for (int y = y0; y < y1; y++, out += SCR_W, v += step) *out = col[(v >> 16) & (MAZE_TEX - 1)];
+    } else {
+      for (int y = y0; y < y1; y++, out += SCR_W, v += step) out[0] = out[1] = col[(v >> 16) & (MAZE_TEX - 1)];
+    }
+  }
+}
+
+static void renderMaze(uint8_t* buf) {
+  mazeWalk();
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int y = y0; y < y1; y++) memset(buf + y * SCR_W, mazeRowColor[y], SCR_W);
+  });
+  int wide = SCR_W / mazeCols;
+  jobsFor(SCR_W, [&](int x0, int x1) { mazeColumns(buf, x0, x1, wide); }, 16);
 }
 
 // ============================================================
@@ -781,30 +1960,45 @@ static void diffDraw(LGFX_Sprite* sp0, LGFX_Sprite* sp1) {
 // Transition helpers
 // ============================================================
 static void applyBrightness(uint8_t* buf, uint8_t brightness) {
-  int total = SCR_W * SCR_H;
-  for (int i = 0; i < total; i++) {
-    buf[i] = rgb332_dim(buf[i], brightness);
-  }
+  // One 256-entry table per call instead of unpack/scale per pixel
+  uint8_t dimLUT[256];
+  for (int i = 0; i < 256; i++) dimLUT[i] = rgb332_dim(i, brightness);
+  jobsFor(SCR_H, [&](int y0, int y1) {
+    for (int i = y0 * SCR_W; i < y1 * SCR_W; i++) {
+      buf[i] = dimLUT[buf[i]];
+    }
+  });
 }
 
-static void startTransition() {
-  transitioning = true;
-  transPhase = 0;
-  transStart = millis();
+// Modes that redraw every pixel from per-frame state render in strips
+// (strips.h) and never touch the full-frame sprites
+static bool stripRendered(Mode m) {
+  return stripsReady() && m == MODE_STARFIELD;
+}
+
+// Render and push a Starfield frame a strip at a time; the fade goes
+// into the strip table. Returns render time in us.
+static uint32_t pushStrips(uint8_t brightness) {
+  uint8_t out[256];
+  for (int i = 0; i < 256; i++) out[i] = brightness < 255 ? rgb332_dim(i, brightness) : i;
+  stripsPalette(out);
+  return stripsPush(lcd, SCR_H, SCR_H / 2, [&](uint8_t* dst, int y0, int y1) {
+    starfieldBand(dst, y0, y1);
+  });
 }
 
 static uint32_t randomModeDuration() {
-  return random(45000, 90001);
+  return prngRange(rngSystem, 45000, 90001);
 }
 
 // ============================================================
 // NeoPixel update — sample sprite buffer, EMA smooth
 // ============================================================
-static void updateNeoPixels(uint8_t* buf) {
-  int sy = SCR_H / 2;
+static void updateNeoPixels(const uint8_t* row) {
+  // Sample along the center row
   for (int i = 0; i < NUM_LEDS; i++) {
     int sx = (SCR_W * (i + 1)) / (NUM_LEDS + 1);
-    uint8_t c = buf[sy * SCR_W + sx];
+    uint8_t c = row[sx];
     uint8_t r, g, b;
     rgb332_unpack(c, r, g, b);
 
@@ -896,26 +2090,124 @@ static void saveScreenshot(uint8_t* buf) {
 #endif
 
 // ============================================================
-// Mode init dispatcher
+// Quality knobs per mode (governor.h)
 // ============================================================
-static void activateNextMode() {
-  currentMode = (Mode)((currentMode + 1) % MODE_COUNT);
+// Counts start at their defaults and may grow into spare frame time up
+// to their array sizes; modes without knobs still get stats.
+#define GOV_TARGET_US 33333  // 30 fps
+static const GovKnob govToasters[] = { { "flyers", &flyerCount, 6, MAX_FLYERS, 3 } };
+static const GovKnob govStars[] = { { "stars", &starCount, 100, MAX_STARS, 50 } };
+static const GovKnob govMatrix[] = { { "trail", &matTrail, 6, MATRIX_TRAIL_MAX, 3 } };
+static const GovKnob govMystify[] = { { "shapes", &mystCount, 1, MYSTIFY_SHAPES, 1 } };
+static const GovKnob govMaze[] = { { "rays", &mazeCols, SCR_W / 2, SCR_W, SCR_W / 2 } };
+static const GovMode govModes[MODE_COUNT] = {
+  { GOV_KNOBS(govToasters), GOV_TARGET_US },
+  { nullptr, 0, GOV_TARGET_US },           // pipes
+  { GOV_KNOBS(govStars), GOV_TARGET_US },
+  { GOV_KNOBS(govMatrix), GOV_TARGET_US },
+  { GOV_KNOBS(govMystify), GOV_TARGET_US },
+  { nullptr, 0, GOV_TARGET_US },           // bounce
+  { nullptr, 0, GOV_TARGET_US },           // fire
+  { nullptr, 0, GOV_TARGET_US },           // life
+  { nullptr, 0, GOV_TARGET_US },           // mandelbrot: refines into govRenderBudget()
+  { nullptr, 0, GOV_TARGET_US },           // polyhedra
+  { GOV_KNOBS(govMaze), GOV_TARGET_US },
+};
+
+// ============================================================
+// Mode init dispatcher — incremental, runs during the fade-out
+// ============================================================
+#define PREWARM_STARS 100  // stars spawned per fade-out frame
+#define PREWARM_COLS  10   // matrix columns per fade-out frame
+#define PREWARM_FIRE_ROWS 40  // heat rows cleared per fade-out frame
+#define PREWARM_LIFE_ROWS 60  // Life rows seeded per fade-out frame
+#define PREWARM_MANDEL_ROWS 80  // Mandelbrot rows reset per fade-out frame
+
+// Run one slice of mode m's init. Returns true once m is ready.
+static bool prewarmSlice(Mode m, int& pos) {
+  int end;
+  switch (m) {
+    case MODE_STARFIELD:
+      end = pos + PREWARM_STARS;
+      if (end > MAX_STARS) end = MAX_STARS;
+      initStarfield(pos, end);
+      pos = end;
+      return pos >= MAX_STARS;
+    case MODE_MATRIX:
+      end = pos + PREWARM_COLS;
+      if (end > MATRIX_COLS) end = MATRIX_COLS;
+      initMatrix(pos, end);
+      pos = end;
+      return pos >= MATRIX_COLS;
+    case MODE_FIRE:
+      end = pos + PREWARM_FIRE_ROWS;
+      if (end > FIRE_H + 1) end = FIRE_H + 1;
+      initFire(pos, end);
+      pos = end;
+      return pos >= FIRE_H + 1;
+    case MODE_LIFE:
+      end = pos + PREWARM_LIFE_ROWS;
+      if (end > SCR_H) end = SCR_H;
+      initLife(pos, end);
+      pos = end;
+      return pos >= SCR_H;
+    case MODE_MANDEL:
+      end = pos + PREWARM_MANDEL_ROWS;
+      if (end > SCR_H) end = SCR_H;
+      initMandel(pos, end);
+      pos = end;
+      return pos >= SCR_H;
+    case MODE_TOASTERS: initToasters(); return true;
+    case MODE_PIPES:    initPipes(); return true;
+    case MODE_MYSTIFY:  initMystify(); return true;
+    case MODE_BOUNCE:   initBounce(); return true;
+    case MODE_POLY:     initPoly(); return true;
+    case MODE_MAZE:     initMaze(); return true;
+    default: return true;
+  }
+}
+
+static void startTransition() {
+  transitioning = true;
+  transPhase = 0;
+  transStart = millis();
+  nextMode = (Mode)((currentMode + 1) % MODE_COUNT);
+  prewarmPos = 0;
+  prewarmDone = false;
+  // govFrame() is skipped until the next mode starts; the fade-out and
+  // prewarm get the top clock rather than whatever this mode settled on
+  govSetClock(GOV_CLOCKS - 1);
+}
+
+// Allocate the full-frame sprites, cleared, the first time a mode that
+// draws into them starts; strip modes never touch them
+static void spritesBegin() {
+  for (int i = 0; i < 2; i++) {
+    if (_sprites[i].getBuffer()) continue;
+    _sprites[i].setColorDepth(8);
+    if (!_sprites[i].createSprite(SCR_W, SCR_H)) {
+      _sprites[i].setPsram(true);
+      _sprites[i].createSprite(SCR_W, SCR_H);
+    }
+    _sprites[i].clear(0x00);
+  }
+}
+
+static void activateNextMode(uint8_t* buf) {
+  // Finish anything the fade-out didn't get to (only on very slow frames)
+  while (!prewarmDone) prewarmDone = prewarmSlice(nextMode, prewarmPos);
+
+  currentMode = nextMode;
   modeStartTime = millis();
   modeDuration = randomModeDuration();
+  govSelect(&govModes[currentMode]);
 
-  // Clear both buffers for fresh start
-  _sprites[0].clear(0x00);
-  _sprites[1].clear(0x00);
+  if (!stripRendered(currentMode)) spritesBegin();
 
-  switch (currentMode) {
-    case MODE_TOASTERS: initToasters(); break;
-    case MODE_PIPES:    initPipes(); break;
-    case MODE_STARFIELD: initStarfield(); break;
-    case MODE_MATRIX:   initMatrix(); break;
-    case MODE_MYSTIFY:  initMystify(); break;
-    case MODE_BOUNCE:   initBounce(); break;
-    default: break;
-  }
+  // Fresh start: buf is the frame going out now, clear the other one too
+  // (buf is null if the sprites were only allocated just now)
+  if (buf) memset(buf, 0, SCR_W * SCR_H);
+  _sprites[_flip ^ 1].clear(0x00);
 }
 
 // ============================================================
@@ -930,15 +2222,10 @@ void setup() {
     lcd.setRotation(lcd.getRotation() ^ 1);
   }
 
-  for (int i = 0; i < 2; i++) {
-    _sprites[i].setColorDepth(8);
-    if (!_sprites[i].createSprite(SCR_W, SCR_H)) {
-      _sprites[i].setPsram(true);
-      _sprites[i].createSprite(SCR_W, SCR_H);
-    }
-  }
-  _sprites[0].clear(0x00);
-  _sprites[1].clear(0x00);
+  // Strip bands first, so they get DMA-capable internal RAM; the
+  // sprites wait for the first mode that needs them
+  stripsBegin();
+  if (!stripRendered(currentMode)) spritesBegin();
 
   FastLED.addLeds<WS2812B, NEO_PIN, GRB>(leds, NUM_LEDS);
   FastLED.setBrightness(40);
@@ -946,10 +2233,37 @@ void setup() {
   memset(neoG, 0, NUM_LEDS);
   memset(neoB, 0, NUM_LEDS);
 
-  // Build fade LUT — dim each RGB332 color to ~85%
-  for (int i = 0; i < 256; i++) {
-    fadeLUT[i] = rgb332_dim(i, 216);
+  // Second core for band-parallel kernels
+  jobsBegin();
+
+  // Random streams: same seed, one independent stream per mode
+  uint32_t seed = PRNG_SEED ? PRNG_SEED : esp_random();
+  prngSeed(rngToasters, seed, MODE_TOASTERS);
+  prngSeed(rngPipes, seed, MODE_PIPES);
+  prngSeed(rngStars, seed, MODE_STARFIELD);
+  prngSeed(rngMatrix, seed, MODE_MATRIX);
+  prngSeed(rngMystify, seed, MODE_MYSTIFY);
+  prngSeed(rngBounce, seed, MODE_BOUNCE);
+  prngSeed(rngFire, seed, MODE_FIRE);
+  prngSeed(rngLife, seed, MODE_LIFE);
+  prngSeed(rngPoly, seed, MODE_POLY);
+  prngSeed(rngMaze, seed, MODE_MAZE);
+  prngSeed(rngSystem, seed, MODE_COUNT);
+#if ENABLE_PERF_LOG
+  {
+    // Arduino random() vs a stream, on the Matrix per-column workload
+    Prng bench;
+    prngSeed(bench, seed, 99);
+    volatile int32_t sink = 0;
+    uint32_t t0 = micros();
+    for (int i = 0; i < 10000; i++) sink += random(0, 30);
+    uint32_t t1 = micros();
+    for (int i = 0; i < 10000; i++) sink += prngRange(bench, 0, 30);
+    uint32_t t2 = micros();
+    Serial.printf("prng: 10k x random() %lu us, prngRange %lu us\n",
+                  (unsigned long)(t1 - t0), (unsigned long)(t2 - t1));
   }
+#endif
 
 #if ENABLE_SCREENSHOTS
   sdReady = SD.begin(GPIO_NUM_4, SPI, 25000000);
@@ -962,8 +2276,12 @@ void setup() {
   modeDuration = randomModeDuration();
   currentMode = MODE_TOASTERS;
   initToasters();
+  govSelect(&govModes[currentMode]);
 
   lcd.startWrite();
+#if ENABLE_PERF_LOG
+  perfLastUs = micros();
+#endif
 }
 
 // ============================================================
@@ -974,6 +2292,18 @@ void loop() {
   uint32_t now = millis();
   frameCount++;
 
+#if ENABLE_PERF_LOG
+  // Time of the previous frame (render + push + LEDs)
+  uint32_t nowUs = micros();
+  uint32_t frameUs = nowUs - perfLastUs;
+  perfLastUs = nowUs;
+  if (transitioning) {
+    if (frameUs > perfWorstUs) perfWorstUs = frameUs;
+  } else {
+    perfSteadyUs = perfSteadyUs ? (perfSteadyUs * 15 + frameUs) >> 4 : frameUs;
+  }
+#endif
+
   // --- Touch screen: cycle mode ---
   auto touch = M5.Touch.getDetail();
   if (touch.wasPressed()) {
@@ -987,6 +2317,7 @@ void loop() {
   if (M5.BtnB.wasPressed()) {
     LGFX_Sprite& curSp = _sprites[_flip];
     uint8_t* curBuf = (uint8_t*)curSp.getBuffer();
+    if (stripRendered(currentMode)) starfieldBand(curBuf, 0, SCR_H);  // strips left no frame
     lcd.endWrite();
     saveScreenshot(curBuf);
     lcd.startWrite();
@@ -1001,51 +2332,106 @@ void loop() {
   // --- Render current mode ---
   LGFX_Sprite& sp = _sprites[_flip];
   uint8_t* buf = (uint8_t*)sp.getBuffer();
+  Mode frameMode = currentMode;             // a finished fade-out switches currentMode
+  bool striped = stripRendered(frameMode);  // rows render during the push
 
+  uint32_t renderStartUs = micros();
   switch (currentMode) {
     case MODE_TOASTERS:  renderToasters(buf);  break;
     case MODE_PIPES:     renderPipes(buf);      break;
-    case MODE_STARFIELD: renderStarfield(buf);  break;
+    case MODE_STARFIELD:
+      if (striped) starfieldStep();
+      else renderStarfield(buf);
+      break;
     case MODE_MATRIX:    renderMatrix(buf);     break;
     case MODE_MYSTIFY:   renderMystify(buf);    break;
     case MODE_BOUNCE:    renderBounce(buf);     break;
+    case MODE_FIRE:      renderFire(buf);       break;
+    case MODE_LIFE:      renderLife(buf);       break;
+    case MODE_MANDEL:    renderMandel(buf);     break;
+    case MODE_POLY:      renderPoly(buf);       break;
+    case MODE_MAZE:      renderMaze(buf);       break;
     default: break;
   }
+  uint32_t renderUs = micros() - renderStartUs;
 
   // --- Handle transition fade ---
+  uint8_t bright = 255;
   if (transitioning) {
     uint32_t elapsed = now - transStart;
     if (transPhase == 0) {
       if (elapsed >= TRANS_DURATION) {
-        applyBrightness(buf, 0);
+#if ENABLE_PERF_LOG
+        Serial.printf("mode %d: render %lu us\n", (int)currentMode, (unsigned long)perfRenderUs);
+        perfRenderUs = 0;
+        if (currentMode == MODE_MANDEL) mandReport();
+        if (currentMode == MODE_POLY) polyReport();
+        char gov[192];
+        govFormat(gov, sizeof(gov));
+        Serial.printf("gov: mode %d: %s\n", (int)currentMode, gov);
+#endif
+        bright = 0;
         transPhase = 1;
         transStart = now;
-        activateNextMode();
+        activateNextMode(buf);
       } else {
-        uint8_t bright = 255 - (uint8_t)((elapsed * 255) / TRANS_DURATION);
-        applyBrightness(buf, bright);
+        bright = 255 - (uint8_t)((elapsed * 255) / TRANS_DURATION);
+        if (!prewarmDone) prewarmDone = prewarmSlice(nextMode, prewarmPos);
       }
     } else {
       if (elapsed >= TRANS_DURATION) {
         transitioning = false;
+#if ENABLE_PERF_LOG
+        Serial.printf("transition -> mode %d: worst frame %lu us, steady %lu us\n",
+                      (int)currentMode, (unsigned long)perfWorstUs, (unsigned long)perfSteadyUs);
+        perfWorstUs = 0;
+#endif
       } else {
-        uint8_t bright = (uint8_t)((elapsed * 255) / TRANS_DURATION);
-        applyBrightness(buf, bright);
+        bright = (uint8_t)((elapsed * 255) / TRANS_DURATION);
       }
     }
   }
 
   // --- Push to display ---
-  bool useDiffDraw = (currentMode == MODE_MATRIX || currentMode == MODE_MYSTIFY);
-  if (useDiffDraw) {
-    diffDraw(&_sprites[_flip], &_sprites[_flip ^ 1]);
+  uint32_t presentStartUs = micros();
+  bool useDiffDraw = (currentMode == MODE_MATRIX || currentMode == MODE_MYSTIFY ||
+                      currentMode == MODE_LIFE);
+  if (striped) {
+    // Rows render strip by strip while the previous strip is on the bus
+    uint32_t stripUs = pushStrips(bright);
+    renderUs += stripUs;
+    presentStartUs += stripUs;
   } else {
-    sp.pushSprite(&lcd, 0, 0);
+    if (bright < 255) applyBrightness(buf, bright);
+    if (useDiffDraw) {
+      diffDraw(&_sprites[_flip], &_sprites[_flip ^ 1]);
+    } else if (currentMode == MODE_FIRE) {
+      pushFire(sp);
+    } else if (currentMode == MODE_POLY) {
+      pushPoly(sp);
+    } else {
+      sp.pushSprite(&lcd, 0, 0);
+    }
+    _flip ^= 1;
   }
-  _flip ^= 1;
+  if (!transitioning) govFrame(renderUs, micros() - presentStartUs);
+#if ENABLE_PERF_LOG
+  // Strip modes render during the push, so render time is final only here
+  if (frameMode == currentMode) {
+    perfRenderUs = perfRenderUs ? (perfRenderUs * 15 + renderUs) >> 4 : renderUs;
+  }
+#endif
+#if ENABLE_POWER_TRACE
+  if (now - traceLastMs >= POWER_TRACE_MS) {
+    traceLastMs = now;
+    char line[96];
+    govTrace(line, sizeof(line), now, (int)currentMode, M5.Power.getBatteryCurrent());
+    Serial.println(line);
+  }
+#endif
 
   // --- NeoPixels (every 3rd frame) ---
   if (frameCount % 3 == 0) {
-    updateNeoPixels(buf);
+    updateNeoPixels(striped ? _strips.kept : buf + SCR_H / 2 * SCR_W);
   }
 }
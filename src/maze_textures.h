@@ -0,0 +1,2075 @@
+#pragma once
+// Auto-generated by gen_maze_textures.py -- do not edit
+// 3D Maze wall atlas: RGB332, column-major, then the same set dimmed
+
+#include <stdint.h>
+
+#define MAZE_TEX 64
+#define MAZE_TEXTURES 4  // brick, stone, wood, exit
+
+static const uint8_t mazeAtlas[8][MAZE_TEX * MAZE_TEX] = {
+  { // brick
+    0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0x92, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA8, 0xA4, 0xC8, 0xC8, 0xA4, 0xA4, 0xA4, 0x92, 0xC8, 0xA8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xB6,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x92,
+    0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xC8, 0xC8, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0xA8, 0xA4, 0xA4, 0xA4, 0xC8, 0xC8, 0xA4, 0x92, 0xA8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0x92,
+    0x84, 0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0xA8, 0xC8, 0x92,
+    0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0xC8, 0xA4, 0x92, 0xA8, 0x84, 0xA8, 0xA4, 0xA4, 0xA8, 0xA4, 0x92,
+    0x64, 0x84, 0x84, 0x84, 0x64, 0x84, 0x84, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xB6,
+    0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92,
+    0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA4, 0xC8, 0xA4, 0xA4, 0xA8, 0xC8, 0xC8, 0x92, 0xA8, 0xA8, 0xA8, 0xC8, 0xA8, 0xA4, 0xA8, 0x92,
+    0x84, 0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0x84, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x92,
+    0xA8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0x92, 0xA8, 0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0x92, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x92,
+    0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0x92, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA8, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0x92, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0xA8, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0xB6, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0xB6,
+    0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0x84, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0x92,
+    0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0xA8, 0xA8, 0x92, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0xB6,
+    0xA8, 0xA4, 0xA4, 0xC8, 0xC8, 0xA8, 0xA8, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0xB6, 0x92, 0xB6,
+    0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92,
+    0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0x92, 0xA4, 0xA8, 0xA8, 0xA8, 0xA4, 0xA4, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xC8, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x64, 0x84, 0x84, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0xA4, 0xA4, 0x92, 0x64, 0x64, 0x84, 0x84, 0x84, 0x64, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x64, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA8, 0xA4, 0xC8, 0xA8, 0xC8, 0xA4, 0xC8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0xA8, 0xA4, 0xA8, 0x92,
+    0xA4, 0xA8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0x92, 0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xB6,
+    0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0x84, 0xA8, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA8, 0xA8, 0xA4, 0xA4, 0xA4, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x64, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xC8, 0xC8, 0xC8, 0xA4, 0xA8, 0xA8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xA4, 0x84, 0xA8, 0xA4, 0xA8, 0xA8, 0xA4, 0x92,
+    0xA4, 0xA8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0x92, 0x64, 0x84, 0x84, 0x64, 0x64, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0xB6, 0xC8, 0xC8, 0xA4, 0xA4, 0xC8, 0xA8, 0xA4, 0x92,
+    0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xA4, 0x84, 0xA8, 0x84, 0xA4, 0xA4, 0x84, 0x92,
+    0xA4, 0xA4, 0xC8, 0xA4, 0xA4, 0xA8, 0xA4, 0xB6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xA8, 0x84, 0x84, 0xA8, 0x84, 0xA4, 0xA4, 0x92,
+    0xA4, 0xC8, 0xA8, 0xA4, 0xA8, 0xA4, 0xA8, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0xC8, 0xA4, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0x92, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xA4, 0xA4, 0xA8, 0x84, 0xA8, 0xA8, 0x84, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0xB6, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92,
+    0xA8, 0xA8, 0xA8, 0xC8, 0xA8, 0xA8, 0xA4, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA4, 0xA8, 0xA4, 0xA8, 0x84, 0xA4, 0x84, 0x92,
+    0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA4, 0xB6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64, 0x84, 0x92,
+    0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0xB6,
+    0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0x92, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x92,
+    0xA4, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xB6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA8, 0xA4, 0xA4, 0xA8, 0xA8, 0xA4, 0xA8, 0xB6, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0x92, 0xA4, 0x84, 0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xB6,
+    0xA4, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA4, 0x92, 0x84, 0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xB6,
+    0xA8, 0xA4, 0xA8, 0xA8, 0xA4, 0xA4, 0xA4, 0x92, 0xC8, 0xA8, 0xA8, 0xA4, 0xC8, 0xC8, 0xC8, 0xB6,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0xA4, 0xA4, 0xA8, 0x84, 0xA4, 0x84, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xC8, 0xA8, 0xA8, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92,
+    0xA4, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0x92, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA4, 0xA8, 0xA8, 0xA8, 0xA4, 0xA4, 0x84, 0xB6,
+    0xA4, 0xA8, 0xA8, 0xC8, 0xA8, 0xA4, 0xC8, 0xB6, 0x84, 0x84, 0x84, 0x64, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xA4, 0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0x92, 0xC8, 0xA4, 0xA4, 0xA8, 0xC8, 0xA8, 0xA8, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA4, 0xA4, 0xA8, 0xA4, 0x84, 0x84, 0xA8, 0x92,
+    0xA8, 0xC8, 0xC8, 0xA8, 0xA4, 0xA8, 0xA8, 0xB6, 0x64, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xB6, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0xA4, 0xA8, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x92, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0x64, 0x84, 0x84, 0x84, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0xB6,
+    0xA4, 0xA8, 0xC8, 0xC8, 0xA8, 0xA4, 0xC8, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92,
+    0xA4, 0xA8, 0xA4, 0xA4, 0xA8, 0xA8, 0xC8, 0x92, 0x92, 0xB6, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x92,
+    0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0xC8, 0x92, 0xA4, 0x84, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0xB6,
+    0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA4, 0xA8, 0x92,
+    0xA8, 0xC8, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xA4, 0xC8, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92, 0xA8, 0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x92,
+    0xC8, 0xA8, 0xC8, 0xA4, 0xA8, 0xA8, 0xA4, 0xB6, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA4, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92, 0xA4, 0x84, 0xA4, 0xA8, 0xA4, 0xA4, 0x84, 0x92,
+    0xA4, 0xA8, 0xA4, 0xC8, 0xA4, 0xA4, 0xA8, 0x92, 0xA4, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0xA4, 0xA8, 0xA4, 0xA4, 0x84, 0xC8, 0xC8, 0xB6,
+    0xA4, 0xA8, 0xA8, 0xA4, 0xA8, 0xC8, 0xA4, 0x92, 0xA4, 0xA8, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0x92,
+    0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92, 0x84, 0xA8, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0x92,
+    0xA8, 0xA4, 0xC8, 0xC8, 0xC8, 0xA4, 0xA4, 0xB6, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x92,
+    0x84, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0xB6, 0xC8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0xA8, 0xB6,
+    0xA8, 0xA4, 0xC8, 0xA8, 0xA4, 0xA4, 0xA4, 0x92, 0xC8, 0xA4, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x64, 0x92, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x92,
+    0xC8, 0xC8, 0xA4, 0xC8, 0xA4, 0xA4, 0xA4, 0x92, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0xB6,
+    0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x92, 0xA8, 0xA4, 0xC8, 0x84, 0xA4, 0xA4, 0xA8, 0xB6,
+    0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0x92, 0xA4, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x92,
+    0xA4, 0xC8, 0xA8, 0xA8, 0xA8, 0xA4, 0xA8, 0x92, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x92, 0xA4, 0x84, 0xA4, 0x84, 0xA8, 0xA8, 0x84, 0x92,
+    0xA4, 0xA8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0x92, 0xA8, 0xA4, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x92,
+    0xA8, 0xC8, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x92,
+    0xA8, 0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0x92, 0xA8, 0xA4, 0xA8, 0xA8, 0xA4, 0xC8, 0xC8, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x84, 0xA4, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x84, 0xA4, 0x84, 0xC8, 0xA4, 0xA8, 0xA8, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xC8, 0xC8, 0xC8, 0xA4, 0xC8, 0xA8, 0xA4, 0x92,
+    0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x92, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xA8, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0x92, 0xA4, 0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xB6, 0xA8, 0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0xA8, 0xB6,
+    0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xA4, 0xA8, 0xC8, 0xC8, 0xA4, 0xA8, 0x92,
+    0xA4, 0xA8, 0x84, 0xA8, 0xA4, 0x84, 0xA4, 0x92, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0xA8, 0x92,
+    0xA8, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0xA8, 0xB6, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0x92,
+    0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92, 0xC8, 0xA4, 0xC8, 0xA4, 0xA8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA8, 0x84, 0x84, 0xA8, 0x84, 0xA4, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xB6, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0xB6,
+    0xA8, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0xA8, 0x92, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0x92,
+    0x84, 0xA4, 0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x92, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0xA4, 0x92, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x92,
+    0xA8, 0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x92, 0xA8, 0xA8, 0xA4, 0xA8, 0x84, 0xA4, 0xA4, 0x92,
+    0xA4, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0xB6, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0xA4, 0xA8, 0xA4, 0xA8, 0xA8, 0x84, 0xA8, 0x92, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0x92, 0x84, 0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA8, 0xA4, 0x92, 0xA8, 0x84, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x92,
+    0xA4, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0xA8, 0x92,
+    0xA4, 0xA8, 0x84, 0xA8, 0x84, 0xA4, 0xA4, 0x92, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0x92, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x92,
+    0xA4, 0x84, 0xA4, 0xA8, 0xA8, 0xA4, 0xA4, 0x92, 0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0xA4, 0xA4, 0x92,
+    0x84, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x92, 0xA8, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0xA8, 0x92,
+    0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0xA8, 0x92, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0xB6,
+    0x84, 0xA4, 0x84, 0x84, 0xA4, 0xA8, 0xA8, 0x92, 0xA8, 0xC8, 0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0x92,
+    0x84, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x92, 0xA8, 0xC8, 0xC8, 0xA4, 0xA8, 0xA4, 0xA8, 0x92,
+    0xA4, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92,
+    0xA8, 0xA8, 0xA4, 0xA4, 0xA8, 0xA8, 0xA8, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x84, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92,
+    0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x84, 0xA8, 0x92, 0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0xA8, 0xA4, 0x92,
+    0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xA8, 0xC8, 0xC8, 0xA4, 0xA8, 0xA8, 0xA8, 0x92,
+    0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA8, 0x92, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0xA8, 0xA4, 0x92,
+    0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x92, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92,
+    0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0xA4, 0xA4, 0xA8, 0xA8, 0xC8, 0xA4, 0xA4, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0x92, 0xA8, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA4, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x92, 0xC8, 0xC8, 0xA8, 0xA8, 0xA8, 0xA8, 0xC8, 0x92,
+    0x84, 0xA4, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x92, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x92, 0xA4, 0xA4, 0xA8, 0xA8, 0xA8, 0xC8, 0xA8, 0x92,
+    0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0xC8, 0xA8, 0xC8, 0xA8, 0xA4, 0xC8, 0xA8, 0x92,
+    0xA8, 0x84, 0xA4, 0xA4, 0xA8, 0xA8, 0xA4, 0xB6, 0xA8, 0xA4, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92,
+    0x84, 0x84, 0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x92, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0x92,
+    0xA4, 0xA8, 0xA8, 0x84, 0xA4, 0x84, 0xA4, 0x92, 0xA8, 0xC8, 0xA4, 0xA4, 0xC8, 0xC8, 0xA8, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xB6, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0xA4, 0xA4, 0xA8, 0xA4, 0xA4, 0xB6, 0xA8, 0xA4, 0xC8, 0xA8, 0xC8, 0xA4, 0xA4, 0xB6,
+    0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0x92, 0xA4, 0xA8, 0xC8, 0xA4, 0xA4, 0xA4, 0xA4, 0x92,
+    0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xB6, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xA8, 0xA4, 0x92,
+    0x84, 0xA8, 0xA8, 0xA8, 0xA4, 0xA8, 0xA4, 0x92, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x92, 0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0xA4, 0x84, 0xA8, 0xA4, 0xA4, 0x92, 0xC8, 0xC8, 0xA8, 0xC8, 0xA4, 0xA8, 0xA4, 0x92,
+    0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92, 0xC8, 0xA4, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA4, 0xA4, 0x84, 0xA8, 0xA8, 0x84, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0x92,
+    0x84, 0xA4, 0xA4, 0xA8, 0xA8, 0xA4, 0x84, 0xB6, 0xA8, 0xC8, 0xA4, 0xA4, 0xA8, 0xC8, 0xC8, 0x92,
+    0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xC8, 0xA8, 0xA8, 0xC8, 0xA4, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0x92, 0xA8, 0xA8, 0xA8, 0xA4, 0xA8, 0xA8, 0xA8, 0x92,
+    0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x92, 0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0xA8, 0xC8, 0xA4, 0xA4, 0xC8, 0xA4, 0xA8, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0xA8, 0xA4, 0xC8, 0xA4, 0xA4, 0xA4, 0xA8, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0xA8, 0xA4, 0xC8, 0xA8, 0xA4, 0xA4, 0xC8, 0x92,
+    0x92, 0x92, 0x92, 0xB6, 0xB6, 0xB6, 0x92, 0x92, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92,
+    0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x92, 0xA8, 0xA8, 0xA8, 0xA4, 0xA4, 0xA8, 0xC8, 0x92,
+    0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0xA8, 0xB6,
+    0xA8, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xB6,
+    0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA4, 0xA8, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0xB6, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x92, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0x92,
+    0xA4, 0xC8, 0xC8, 0xA4, 0xA8, 0xA8, 0xC8, 0xB6, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x92, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92,
+    0xA4, 0xA4, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x92, 0xA4, 0xA4, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA8, 0xA8, 0xC8, 0xA8, 0x92, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xA4, 0xA8, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0x84, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x92, 0xA4, 0xA8, 0xC8, 0xA4, 0xC8, 0xC8, 0xC8, 0x92,
+    0xA4, 0xC8, 0xC8, 0xC8, 0xA8, 0xA4, 0xA8, 0x92, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92, 0xC8, 0xC8, 0xA8, 0xA4, 0xC8, 0xC8, 0xC8, 0xB6,
+    0x84, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0x92, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0xA4, 0x84, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x92, 0xA4, 0xA8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xA4, 0xC8, 0xA4, 0x92, 0xC8, 0xA4, 0xC8, 0xA4, 0xC8, 0xA8, 0xA8, 0x92,
+    0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92, 0xA8, 0xA4, 0xC8, 0xC8, 0xA8, 0xA8, 0xA4, 0x92,
+    0x84, 0xA4, 0xA8, 0xA8, 0xA4, 0xA4, 0xA8, 0x92, 0xA8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0x92,
+    0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0xB6, 0xC8, 0xA4, 0xA8, 0xA8, 0xA4, 0xA8, 0xA8, 0x92,
+    0xC8, 0xC8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA4, 0x92, 0xC8, 0xA8, 0xA4, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0xC8, 0xA8, 0xC8, 0xA8, 0xA8, 0xA8, 0xA8, 0x92,
+    0xA4, 0xA4, 0x84, 0xA8, 0xA4, 0x84, 0x84, 0x92, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0x92,
+    0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x92, 0x92, 0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x84, 0xA8, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0xA4, 0x84, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x92, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x84, 0x92,
+    0xC8, 0xA8, 0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xB6, 0xC8, 0xA8, 0xA4, 0xA4, 0xA8, 0x84, 0xA4, 0x92,
+    0xC8, 0xA8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xB6, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0x92,
+    0xA4, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x92, 0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xA4, 0x92,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0xA8, 0xA8, 0xA8, 0xA4, 0xA8, 0xA4, 0xA4, 0x92,
+    0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xB6, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x92, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0xA4, 0x84, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xA8, 0xA8, 0x92, 0xA8, 0xA8, 0xA8, 0xA4, 0xA4, 0xA4, 0xA4, 0xB6,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0x92, 0xC8, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0xA4, 0x84, 0xA4, 0xA8, 0xA4, 0x84, 0x84, 0x92, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x92,
+    0x84, 0x84, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0x92, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x92,
+    0xA8, 0xA8, 0xC8, 0xA4, 0xA8, 0xC8, 0xC8, 0x92, 0xA4, 0xA8, 0xA4, 0xA4, 0xA8, 0xA8, 0x84, 0x92,
+    0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xC8, 0xC8, 0x92, 0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x84, 0xA4, 0xB6, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x84, 0xB6,
+    0xA4, 0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x92, 0x84, 0xA4, 0xA4, 0xA4, 0x84, 0x84, 0xA4, 0x92,
+    0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xA8, 0xA4, 0xA4, 0xC8, 0xA8, 0xA4, 0xA8, 0x92,
+    0xA8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0x84, 0xA4, 0xA4, 0xA4, 0xA4, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0xA4, 0xA4, 0x84, 0xA4, 0xA4, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xA8, 0x92, 0xA4, 0xA4, 0x84, 0xA8, 0xC8, 0xA8, 0xA4, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0x92,
+    0x84, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0xB6, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x84, 0x84, 0x84, 0x84, 0xA4, 0xA4, 0x84, 0xB6, 0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0xA4, 0x92,
+    0xA8, 0xA4, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0xB6, 0xA4, 0xA8, 0xA8, 0x84, 0xA8, 0xA4, 0xA4, 0x92,
+    0xC8, 0xA8, 0xC8, 0xC8, 0xC8, 0xA8, 0xA8, 0x92, 0xA8, 0xC8, 0xA8, 0xC8, 0xC8, 0xA8, 0xC8, 0x92,
+    0xA8, 0x84, 0xA4, 0xA4, 0x84, 0x84, 0x84, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xA4, 0xB6,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB6, 0xA4, 0xA8, 0xA4, 0xA4, 0xA8, 0xC8, 0xA4, 0x92,
+    0x92, 0x92, 0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0xA8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x84, 0xA4, 0x84, 0x84, 0xA4, 0x84, 0x84, 0x92
+  },
+  { // stone
+    0xB6, 0x92, 0x92, 0x6D, 0x6D, 0x6E, 0x92, 0x6E, 0x6D, 0x6E, 0x92, 0x6D, 0x6E, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x49,
+    0xB6, 0x92, 0x6E, 0x6D, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0xB6, 0x6D, 0x6E, 0x6D, 0x92, 0x6E, 0x92, 0x6D, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x25, 0x25, 0x24,
+    0x24, 0x49, 0x25, 0x25, 0x49, 0x25, 0x49, 0x25, 0x25, 0x25, 0x49, 0x25, 0x24, 0x25, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x24, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x24,
+    0xB6, 0x92, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x92, 0x6D, 0x6E, 0x92, 0x6D, 0x6E, 0x25, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x25, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x25,
+    0xB6, 0x6D, 0x92, 0x92, 0x6E, 0x92, 0x6D, 0x92, 0x6D, 0x92, 0x92, 0x6E, 0x6D, 0x49, 0x92, 0x6D,
+    0x6D, 0x6D, 0x49, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x49, 0x6D, 0x49, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x25, 0x49, 0x49,
+    0x25, 0x49, 0x24, 0x25, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x25, 0x25, 0x49, 0x24, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x25, 0x49, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x49, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x49,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49,
+    0xB6, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x6D, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6E, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49,
+    0xB6, 0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6D, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0xB6, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6D, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6E, 0x49, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x24, 0x25, 0x25,
+    0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x24, 0x25, 0x49, 0x25, 0x24, 0x25, 0x25, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0xB6, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49,
+    0xB6, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x24, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0x92, 0x6D,
+    0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x49, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x24,
+    0xB6, 0x6E, 0x92, 0x6D, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x24, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x49,
+    0xB6, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0x92, 0x6D,
+    0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x25,
+    0xB6, 0x6D, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x49, 0x49, 0x6D, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6E, 0x6E, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0xB6, 0x6E, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x6E, 0x6D, 0x92, 0x6E, 0x6D, 0x92, 0x49, 0x92, 0x6D,
+    0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0x92, 0x6E,
+    0x6D, 0x6E, 0x49, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x24,
+    0xB6, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0x92, 0x49,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x49,
+    0xB6, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x25, 0x49, 0x25,
+    0x25, 0x25, 0x24, 0x49, 0x24, 0x25, 0x25, 0x24, 0x49, 0x25, 0x25, 0x25, 0x25, 0x49, 0x92, 0x6D,
+    0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49,
+    0xB6, 0x6E, 0x6E, 0x6E, 0x92, 0x6D, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x49, 0x92, 0x6E,
+    0x6D, 0x6D, 0x6E, 0x49, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x25,
+    0xB6, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x25, 0xB6, 0x6E,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25,
+    0xB6, 0x6D, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0x49, 0xB6, 0x6E,
+    0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x49,
+    0xB6, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x49, 0x49, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0xB6, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x25, 0x92, 0x6E,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x6E,
+    0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49,
+    0xB6, 0x6E, 0x92, 0x6D, 0x6E, 0x92, 0x6E, 0x6E, 0x6D, 0x92, 0x92, 0x92, 0x6E, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25,
+    0x49, 0x49, 0x25, 0x25, 0x49, 0x25, 0x25, 0x25, 0x24, 0x25, 0x49, 0x25, 0x25, 0x25, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x6E, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x24,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x92,
+    0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0x25, 0x25,
+    0x25, 0x49, 0x25, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x49, 0x49, 0x49, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x24,
+    0x92, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x25, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x25, 0x24,
+    0x49, 0x25, 0x25, 0x25, 0x49, 0x25, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6D, 0x6E, 0x92, 0x6E, 0x6E, 0x6E, 0x25, 0xB6, 0x6E,
+    0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6D, 0x92, 0x6E, 0x6D, 0x6E, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x24, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x25,
+    0x92, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6E, 0x92, 0x6E, 0x6D, 0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x6D, 0x25, 0xB6, 0x6E,
+    0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x49,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x24, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6E, 0x6D, 0x92, 0x6D, 0x6D, 0x6D, 0x92, 0x6E, 0x6D, 0x6D, 0x92, 0x49, 0xB6, 0x92,
+    0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0x92, 0x6D, 0x6D, 0x6E, 0x6D, 0x92, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x25, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x49, 0x92, 0x6E,
+    0x6E, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x92, 0x6E, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0x92, 0x6E,
+    0x92, 0x6D, 0x6D, 0x92, 0x6E, 0x6D, 0x92, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x25, 0xB6, 0x6E,
+    0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x49,
+    0x92, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x49, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x25, 0x92, 0x6E,
+    0x6E, 0x92, 0x6D, 0x6E, 0x6D, 0x92, 0x6E, 0x92, 0x6D, 0x6E, 0x6E, 0x6D, 0x6E, 0x25, 0xB6, 0x6E,
+    0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x6E, 0x25, 0xB6, 0x6E,
+    0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0x92, 0x6E,
+    0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x92, 0x6D, 0x6E, 0x6D, 0x92, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x24, 0xB6, 0x6E,
+    0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x24, 0x92, 0x6E,
+    0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x92, 0x92, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x24,
+    0x92, 0x92, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x6E,
+    0x92, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x6E, 0x49, 0x92, 0x92,
+    0x6E, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x92, 0x6D, 0x6D, 0x92, 0x6E, 0x25, 0xB6, 0x6E,
+    0x92, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x49,
+    0x92, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x6E, 0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6E, 0x6D, 0x6D, 0x92, 0x6E, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x49, 0xB6, 0x92,
+    0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x24,
+    0x92, 0x6E, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x92, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x92, 0x6D, 0x6D, 0x6E, 0x49, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x25,
+    0x92, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x49, 0x92, 0x6E,
+    0x92, 0x6E, 0x6E, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x92, 0x6E, 0x6E, 0x25, 0xB6, 0x6E,
+    0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x24,
+    0x92, 0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x92, 0x6D, 0x6E, 0x6D, 0x6E, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x25, 0x92, 0x92,
+    0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x92, 0x6E, 0x6E, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6E, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x92, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25,
+    0x24, 0x49, 0x25, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x25, 0x49, 0x25, 0x49, 0x25,
+    0x92, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x25, 0x49, 0x49,
+    0x25, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x25, 0x25, 0x49, 0x92, 0x6D,
+    0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x6D, 0x6D, 0x6E, 0x92, 0x6E, 0x6E, 0x6E, 0x24, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25,
+    0x49, 0x25, 0x49, 0x49, 0x25, 0x24, 0x49, 0x25, 0x25, 0x24, 0x49, 0x49, 0x25, 0x49, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x25, 0x25, 0x49,
+    0x25, 0x25, 0x25, 0x49, 0x24, 0x25, 0x25, 0x24, 0x49, 0x49, 0x25, 0x24, 0x25, 0x49, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x49, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49,
+    0x92, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x49, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x92,
+    0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x25,
+    0x92, 0x6D, 0x6D, 0x49, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6E, 0x49, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x49, 0xB6, 0x92,
+    0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x6D, 0x49,
+    0x92, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x25,
+    0x92, 0x6D, 0x6D, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x6D, 0x49,
+    0x92, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x6E, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x49, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x24, 0x92, 0x6D,
+    0x6E, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x49,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0xB6, 0x6E,
+    0x92, 0x92, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49,
+    0x92, 0x6D, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x92,
+    0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x25, 0x92, 0x6E,
+    0x6E, 0x6E, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x25,
+    0x92, 0x49, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x6E,
+    0x92, 0x6E, 0x92, 0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x25, 0x92, 0x6E,
+    0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x24,
+    0x92, 0x6E, 0x49, 0x6D, 0x6D, 0x6E, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x24, 0x92, 0x6D,
+    0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x25,
+    0x92, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6E, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x24, 0xB6, 0x92,
+    0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x25, 0x92, 0x6E,
+    0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x25,
+    0x92, 0x6D, 0x6D, 0x6E, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0xB6, 0x6E,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6E, 0x24,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6E, 0x6D, 0x25,
+    0x92, 0x6D, 0x6D, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x24, 0x24, 0x25,
+    0x24, 0x25, 0x49, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x24, 0x92, 0x6D,
+    0x6E, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E, 0x6E, 0x6E, 0x6D, 0x6D, 0x25,
+    0x92, 0x49, 0x6D, 0x49, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x49, 0x6D, 0x49, 0x49, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x24, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x49, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x25,
+    0x92, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x24, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6E, 0x6D, 0x24,
+    0x92, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0x92, 0x6E,
+    0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x25,
+    0x25, 0x49, 0x49, 0x49, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x49, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x25, 0xB6, 0x92,
+    0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x25, 0x25, 0x25,
+    0x25, 0x49, 0x25, 0x49, 0x25, 0x25, 0x25, 0x24, 0x49, 0x49, 0x49, 0x25, 0x25, 0x24, 0x25, 0x25,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x49, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x25, 0xB6, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x6E, 0x92, 0x92, 0x92, 0x92, 0x92, 0x49, 0xB6, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x49
+  },
+  { // wood
+    0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68,
+    0x64, 0x64, 0x64, 0x68, 0x68, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64,
+    0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x68, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88,
+    0x64, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0xAC, 0x88, 0xAC, 0x8C, 0x68, 0x88, 0x8C, 0xAC, 0xAC, 0x8C, 0x68,
+    0x68, 0x88, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0x68, 0x68, 0x8C, 0x8C, 0xAC,
+    0x8C, 0x68, 0x88, 0x88, 0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0x88, 0xAC, 0x8C, 0x88, 0x68, 0x8C,
+    0x88, 0x88, 0xAC, 0x68, 0x68, 0x68, 0xAC, 0x88, 0x8C, 0xAC, 0xAC, 0xAC, 0x8C, 0xAC, 0xAC, 0x88,
+    0xAC, 0xAC, 0x8C, 0x88, 0xAC, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+    0x88, 0xAC, 0x8C, 0x88, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x88, 0xAC, 0xAC, 0xAC,
+    0x8C, 0x8C, 0xAC, 0x88, 0x88, 0x88, 0xAC, 0xAC, 0x8C, 0x8C, 0xAC, 0xAC, 0x8C, 0x8C, 0x88, 0xAC,
+    0x88, 0x8C, 0xAC, 0x8C, 0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C,
+    0x88, 0x88, 0x88, 0x8C, 0xAC, 0xAC, 0x68, 0x68, 0x88, 0xAC, 0xAC, 0xAC, 0xAC, 0x8C, 0x8C, 0xAC,
+    0xAC, 0x8C, 0x68, 0x88, 0x8C, 0x8C, 0x88, 0x8C, 0x88, 0x68, 0x88, 0x8C, 0xAC, 0x8C, 0xAC, 0xAC,
+    0x8C, 0xAC, 0xAC, 0xAC, 0x88, 0x68, 0xAC, 0x8C, 0xAC, 0x88, 0x88, 0x88, 0x88, 0x8C, 0xAC, 0xAC,
+    0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x68, 0x68, 0xAC, 0x88, 0x8C, 0x88, 0x68, 0x68, 0x88, 0xAC,
+    0xAC, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x68, 0x68, 0x68, 0x68, 0xAC,
+    0xAC, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x88, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x88, 0x68, 0x88, 0x88,
+    0x68, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC, 0x68,
+    0x88, 0x88, 0x68, 0x8C, 0x8C, 0x88, 0xAC, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x88,
+    0x88, 0x8C, 0x88, 0x68, 0x88, 0x68, 0x8C, 0xAC, 0x8C, 0x8C, 0x88, 0xAC, 0x8C, 0xAC, 0x88, 0xAC,
+    0x8C, 0xAC, 0x8C, 0x8C, 0x68, 0x68, 0x68, 0x88, 0xAC, 0xAC, 0x8C, 0x88, 0xAC, 0x8C, 0x8C, 0xAC,
+    0x8C, 0xAC, 0xAC, 0x8C, 0x8C, 0xAC, 0x68, 0x88, 0x68, 0x68, 0xAC, 0x8C, 0xAC, 0xAC, 0x8C, 0xAC,
+    0x8C, 0xAC, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0x88, 0x68, 0x88, 0x8C, 0xAC, 0x88, 0x8C,
+    0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0xAC, 0xAC, 0xAC, 0x8C, 0x68, 0x88, 0xAC, 0x8C, 0x8C, 0xAC, 0x68,
+    0x68, 0x88, 0xAC, 0xAC, 0xAC, 0xAC, 0x8C, 0xAC, 0x8C, 0xAC, 0x8C, 0x88, 0x88, 0x88, 0x8C, 0x8C,
+    0x8C, 0x88, 0x88, 0x68, 0x8C, 0x88, 0xAC, 0xAC, 0xAC, 0x8C, 0x8C, 0x8C, 0x88, 0x88, 0x68, 0xAC,
+    0x88, 0x8C, 0x8C, 0x68, 0x88, 0x88, 0xAC, 0xAC, 0x8C, 0xAC, 0x8C, 0xAC, 0xAC, 0x88, 0x8C, 0x68,
+    0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C,
+    0x8C, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x88, 0x8C, 0x8C,
+    0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC, 0x88, 0xAC, 0x8C, 0x88, 0x8C, 0xAC, 0xAC, 0x8C,
+    0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC, 0x8C, 0xAC, 0xAC,
+    0x68, 0x68, 0x8C, 0x8C, 0xAC, 0xAC, 0x88, 0x68, 0x88, 0x8C, 0x8C, 0xAC, 0x88, 0xAC, 0xAC, 0x88,
+    0x8C, 0x88, 0x68, 0x88, 0xAC, 0x8C, 0xAC, 0xAC, 0x88, 0x68, 0x68, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC,
+    0x8C, 0xAC, 0x88, 0xAC, 0x88, 0x68, 0xAC, 0xAC, 0x88, 0x8C, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAC,
+    0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0x8C, 0x88, 0x68, 0x8C, 0x8C, 0xAC, 0x8C, 0x88, 0x68, 0x68, 0x88,
+    0x8C, 0xAC, 0xAC, 0xAC, 0x88, 0x8C, 0x8C, 0xAC, 0xAC, 0x8C, 0xAC, 0x88, 0x68, 0x68, 0x88, 0x88,
+    0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x88, 0x68, 0x68, 0x88,
+    0x68, 0x8C, 0x88, 0x8C, 0x88, 0x8C, 0xAC, 0x8C, 0xAC, 0x88, 0x88, 0x8C, 0x8C, 0xAC, 0x8C, 0x68,
+    0x68, 0x88, 0x88, 0xAC, 0xAC, 0xAC, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0x88, 0x8C, 0xAC, 0xAC, 0xAC,
+    0x8C, 0xAC, 0x88, 0x88, 0x88, 0x68, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0x8C, 0x88,
+    0xAC, 0x88, 0x8C, 0x8C, 0x88, 0x88, 0x68, 0x88, 0x8C, 0x8C, 0x8C, 0x88, 0x88, 0x8C, 0x8C, 0xAC,
+    0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0x88, 0x88, 0x68, 0x8C, 0x8C, 0xAC, 0x8C, 0xAC, 0x8C,
+    0xAC, 0x8C, 0x8C, 0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0x88, 0x88, 0x88, 0x88, 0x8C, 0x88, 0xAC, 0x8C,
+    0xAC, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x88, 0x8C, 0xAC, 0x88, 0x88, 0xAC, 0xAC, 0x88, 0xAC, 0x88,
+    0x68, 0x88, 0xAC, 0x8C, 0xAC, 0x8C, 0xAC, 0xAC, 0xAC, 0x8C, 0xAC, 0x68, 0x68, 0xAC, 0x8C, 0x8C,
+    0xAC, 0x68, 0x88, 0x68, 0x8C, 0xAC, 0x88, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x88, 0x68, 0x8C,
+    0x88, 0x8C, 0x88, 0x68, 0x88, 0x88, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0xAC, 0x88,
+    0x8C, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x88, 0x88, 0x8C, 0x8C, 0xAC,
+    0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C,
+    0x8C, 0x8C, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0x8C, 0x8C, 0xAC, 0xAC, 0x8C,
+    0xAC, 0xAC, 0x88, 0x8C, 0xAC, 0xAC, 0x8C, 0xAC, 0xAC, 0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0xAC,
+    0x68, 0x68, 0xAC, 0x8C, 0xAC, 0x88, 0x88, 0x88, 0x88, 0xAC, 0x8C, 0x8C, 0x8C, 0x88, 0x8C, 0x8C,
+    0x8C, 0x8C, 0x88, 0x68, 0xAC, 0x8C, 0xAC, 0xAC, 0x68, 0x88, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+    0xAC, 0xAC, 0x8C, 0xAC, 0x88, 0x88, 0x88, 0x8C, 0xAC, 0x8C, 0x68, 0x68, 0x68, 0x8C, 0x8C, 0x8C,
+    0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0x8C, 0x68, 0x68, 0x8C, 0x8C, 0x8C, 0x88, 0x68, 0x88, 0x88, 0xAC,
+    0x88, 0x8C, 0x88, 0x88, 0x88, 0xAC, 0x88, 0xAC, 0xAC, 0xAC, 0x88, 0x68, 0x68, 0x88, 0x68, 0x8C,
+    0xAC, 0x88, 0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0x88, 0x8C, 0x88, 0x68, 0x68, 0x88,
+    0x88, 0xAC, 0xAC, 0xAC, 0x8C, 0x8C, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC, 0xAC, 0x88, 0xAC, 0xAC, 0x88,
+    0x68, 0x68, 0x68, 0x88, 0x8C, 0x8C, 0xAC, 0xAC, 0xAC, 0xAC, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+    0xAC, 0x88, 0x68, 0x68, 0x68, 0x68, 0x8C, 0x88, 0x8C, 0x8C, 0x88, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+    0xAC, 0x8C, 0xAC, 0x8C, 0x68, 0x88, 0x88, 0x68, 0x8C, 0xAC, 0xAC, 0xAC, 0xAC, 0x8C, 0x88, 0x88,
+    0xAC, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x88, 0x68, 0x68, 0x68, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0xAC,
+    0x88, 0xAC, 0x8C, 0xAC, 0x8C, 0x8C, 0x88, 0xAC, 0x68, 0x68, 0x88, 0x68, 0x8C, 0x8C, 0x8C, 0x8C,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x68, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88,
+    0x88, 0x68, 0x68, 0x68, 0x68, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x68, 0x88, 0x68, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68,
+    0x88, 0x68, 0x88, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x68, 0x88, 0x88, 0x88, 0x64, 0x44, 0x68, 0x88, 0x88, 0x68, 0x88, 0x44, 0x64, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x68, 0x68, 0x88, 0x44, 0x64,
+    0x88, 0x68, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x68, 0x88, 0x68, 0x88,
+    0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x44, 0x64,
+    0x64, 0x64, 0x64, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88,
+    0x64, 0x64, 0x64, 0x44, 0x64, 0x88, 0x68, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x64, 0x44, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x44, 0x64, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x64, 0x64, 0x64, 0x44, 0x68, 0x88, 0x88, 0x68,
+    0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x44, 0x44, 0x64, 0x64, 0x44, 0x68, 0x88,
+    0x88, 0x88, 0x68, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x68, 0x68, 0x64, 0x64, 0x44, 0x64, 0x44,
+    0x68, 0x64, 0x64, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x68, 0x88, 0x44, 0x64, 0x68, 0x68, 0x68, 0x68, 0x88, 0x88, 0x68, 0x68, 0x68, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88,
+    0x64, 0x64, 0x88, 0x68, 0x88, 0x88, 0x68, 0x44, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88,
+    0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88,
+    0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x64, 0x44, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x64, 0x68, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x44,
+    0x68, 0x68, 0x68, 0x68, 0x88, 0x68, 0x68, 0x88, 0x88, 0x64, 0x44, 0x68, 0x68, 0x88, 0x88, 0x68,
+    0x64, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x88, 0x68, 0x64, 0x44,
+    0x64, 0x44, 0x64, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68,
+    0x64, 0x64, 0x64, 0x64, 0x44, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68,
+    0x68, 0x68, 0x68, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88,
+    0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x64, 0x64, 0x64, 0x64, 0x88, 0x68, 0x68, 0x88,
+    0x88, 0x88, 0x68, 0x68, 0x68, 0x68, 0x88, 0x88, 0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x88,
+    0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x68, 0x44, 0x64, 0x68, 0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x44, 0x64, 0x68, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x88, 0x68, 0x88, 0x68, 0x64, 0x64, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x44, 0x44, 0x88, 0x88, 0x68, 0x68, 0x88, 0x64, 0x64, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88,
+    0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x68,
+    0x88, 0x68, 0x68, 0x64, 0x64, 0x68, 0x88, 0x88, 0x68, 0x88, 0x64, 0x64, 0x88, 0x68, 0x88, 0x68,
+    0x68, 0x88, 0x88, 0x68, 0x68, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x68, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x44, 0x88, 0x68, 0x68, 0x88, 0x68, 0x64, 0x64,
+    0x88, 0x68, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x44, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x44, 0x88, 0x68, 0x68, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x44, 0x64,
+    0x64, 0x64, 0x44, 0x88, 0x68, 0x88, 0x68, 0x68, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88,
+    0x44, 0x44, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x44, 0x64, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x44, 0x64, 0x64, 0x64, 0x64, 0x68, 0x88, 0x68, 0x88,
+    0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x64, 0x44, 0x64, 0x64, 0x88, 0x68,
+    0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x88, 0x64, 0x64, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x68,
+    0x68, 0x68, 0x68, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x44, 0x64,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x44, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88,
+    0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x64, 0x68, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x88, 0x68,
+    0x88, 0x68, 0x68, 0x64, 0x64, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68, 0x88, 0x44, 0x64,
+    0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x64, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68,
+    0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x68, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68,
+    0x88, 0x68, 0x68, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x44, 0x88, 0x68,
+    0x88, 0x68, 0x68, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88, 0x64, 0x44, 0x64, 0x44,
+    0x64, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64,
+    0x64, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x88,
+    0x64, 0x44, 0x64, 0x64, 0x64, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x44, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x68, 0x88, 0x88, 0x44, 0x64, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x64, 0x44, 0x88, 0x68, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x64,
+    0x68, 0x68, 0x88, 0x68, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88,
+    0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88, 0x44, 0x44, 0x68, 0x88, 0x88, 0x88,
+    0x88, 0x64, 0x64, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x68, 0x44, 0x64, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x64, 0x44, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x68, 0x68, 0x88, 0x88, 0x64, 0x44, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x68, 0x88,
+    0x68, 0x88, 0x88, 0x64, 0x44, 0x44, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x88, 0x68, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x44, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88,
+    0x68, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x44, 0x64, 0x64, 0x44,
+    0x64, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x64, 0x44,
+    0x64, 0x64, 0x64, 0x68, 0x88, 0x88, 0x68, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88,
+    0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x44, 0x64, 0x88, 0x88, 0x68, 0x68, 0x68, 0x64, 0x64, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64, 0x88, 0x68, 0x88, 0x68, 0x88, 0x64, 0x64, 0x68, 0x68,
+    0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x64, 0x44, 0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88,
+    0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88,
+    0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68,
+    0x64, 0x68, 0x88, 0x68, 0x68, 0x88, 0x68, 0x88, 0x68, 0x68, 0x44, 0x64, 0x68, 0x88, 0x88, 0x88,
+    0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x44, 0x68, 0x88,
+    0x68, 0x88, 0x88, 0x64, 0x64, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x68, 0x68, 0x88, 0x88, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88,
+    0x68, 0x68, 0x88, 0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x68, 0x88, 0x68, 0x88, 0x88, 0x68, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x64, 0x64, 0x64, 0x44, 0x68, 0x88, 0x88, 0x68, 0x88, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64, 0x64, 0x64, 0x44, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x88, 0x68, 0x88, 0x64, 0x44, 0x64, 0x64, 0x64, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x44, 0x44, 0x64, 0x64,
+    0x44, 0x68, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x64, 0x64, 0x44, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x64, 0x64, 0x88, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x88, 0x68, 0x88, 0x68, 0x88, 0x88,
+    0x68, 0x68, 0x88, 0x64, 0x44, 0x88, 0x88, 0x88, 0x88, 0x68, 0x64, 0x64, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x68, 0x88, 0x88, 0x64, 0x44, 0x88, 0x88, 0x68, 0x88, 0x88, 0x64, 0x64, 0x68, 0x88,
+    0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x44, 0x64, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x64,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68, 0x68, 0x88, 0x88, 0x68, 0x88, 0x88,
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68, 0x68, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x68,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x88, 0x68,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
+  },
+  { // exit
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38
+  },
+  { // brick (dim)
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x64, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x60, 0x60, 0x60, 0x64, 0x60, 0x6D,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x60, 0x60, 0x60, 0x64, 0x64, 0x60, 0x49, 0x64, 0x60, 0x60, 0x60, 0x64, 0x60, 0x60, 0x49,
+    0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x64, 0x64, 0x60, 0x49, 0x64, 0x40, 0x64, 0x60, 0x60, 0x64, 0x60, 0x49,
+    0x20, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D,
+    0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x60, 0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x49,
+    0x64, 0x60, 0x60, 0x60, 0x64, 0x60, 0x60, 0x49, 0x64, 0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x60, 0x40, 0x40, 0x49, 0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x64, 0x64, 0x60, 0x64, 0x60, 0x64, 0x60, 0x49, 0x60, 0x60, 0x64, 0x60, 0x60, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x6D, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x6D,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x40, 0x60, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x60, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49, 0x60, 0x60, 0x60, 0x64, 0x60, 0x60, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x60, 0x60, 0x60, 0x40, 0x6D,
+    0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x64, 0x60, 0x60, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x6D, 0x49, 0x6D,
+    0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49,
+    0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x64, 0x64, 0x64, 0x60, 0x60, 0x60, 0x49,
+    0x60, 0x60, 0x60, 0x64, 0x60, 0x64, 0x64, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x49,
+    0x60, 0x60, 0x60, 0x64, 0x64, 0x60, 0x60, 0x49, 0x20, 0x20, 0x40, 0x40, 0x40, 0x20, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x60, 0x40, 0x40, 0x64, 0x60, 0x64, 0x49,
+    0x60, 0x64, 0x60, 0x60, 0x60, 0x64, 0x60, 0x49, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x6D,
+    0x60, 0x60, 0x40, 0x40, 0x60, 0x40, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x64, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49,
+    0x60, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x40, 0x64, 0x60, 0x64, 0x64, 0x60, 0x49,
+    0x60, 0x64, 0x60, 0x60, 0x60, 0x64, 0x60, 0x49, 0x20, 0x40, 0x40, 0x20, 0x20, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x6D, 0x64, 0x64, 0x60, 0x60, 0x64, 0x64, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x40, 0x64, 0x40, 0x60, 0x60, 0x40, 0x49,
+    0x60, 0x60, 0x64, 0x60, 0x60, 0x64, 0x60, 0x6D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x40, 0x40, 0x64, 0x40, 0x60, 0x60, 0x49,
+    0x60, 0x64, 0x64, 0x60, 0x64, 0x60, 0x64, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x60, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x60, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x49, 0x6D, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x60, 0x60, 0x64, 0x40, 0x64, 0x64, 0x40, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x6D, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x60, 0x49,
+    0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x60, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x60, 0x64, 0x60, 0x64, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x6D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x49,
+    0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x60, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x6D,
+    0x64, 0x60, 0x60, 0x60, 0x60, 0x64, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x60, 0x40, 0x60, 0x40, 0x40, 0x40, 0x60, 0x49,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x60, 0x60, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x64, 0x60, 0x60, 0x64, 0x64, 0x60, 0x64, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x60, 0x40, 0x40, 0x49, 0x60, 0x40, 0x60, 0x60, 0x64, 0x60, 0x64, 0x6D,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49, 0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x6D,
+    0x64, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x6D,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x60, 0x60, 0x64, 0x40, 0x60, 0x40, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x60, 0x64, 0x64, 0x64, 0x60, 0x60, 0x40, 0x6D,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x6D, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x60, 0x64, 0x60, 0x60, 0x60, 0x60, 0x64, 0x49, 0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x60, 0x60, 0x64, 0x60, 0x40, 0x40, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x6D, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x6D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x60, 0x64, 0x64, 0x60, 0x64, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x6D,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49,
+    0x60, 0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x49, 0x49, 0x6D, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x60, 0x60, 0x60, 0x60, 0x40, 0x49,
+    0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x64, 0x49, 0x60, 0x40, 0x60, 0x60, 0x40, 0x40, 0x60, 0x6D,
+    0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49,
+    0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x60, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49, 0x60, 0x40, 0x60, 0x64, 0x60, 0x60, 0x40, 0x49,
+    0x60, 0x64, 0x60, 0x64, 0x60, 0x60, 0x64, 0x49, 0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x60, 0x64, 0x60, 0x60, 0x40, 0x64, 0x64, 0x6D,
+    0x60, 0x64, 0x64, 0x60, 0x64, 0x64, 0x60, 0x49, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49, 0x40, 0x64, 0x40, 0x60, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x60, 0x64, 0x64, 0x64, 0x60, 0x60, 0x6D, 0x60, 0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x49,
+    0x40, 0x60, 0x40, 0x60, 0x40, 0x60, 0x40, 0x6D, 0x64, 0x60, 0x60, 0x60, 0x64, 0x64, 0x64, 0x6D,
+    0x64, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x20, 0x49, 0x60, 0x60, 0x60, 0x40, 0x60, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x60, 0x64, 0x60, 0x60, 0x60, 0x49, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x6D,
+    0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x60, 0x49, 0x64, 0x60, 0x64, 0x40, 0x60, 0x60, 0x64, 0x6D,
+    0x60, 0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x49, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x49,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x49, 0x60, 0x40, 0x60, 0x40, 0x64, 0x64, 0x40, 0x49,
+    0x60, 0x64, 0x60, 0x60, 0x60, 0x64, 0x64, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x60, 0x60, 0x60, 0x64, 0x60, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49, 0x60, 0x60, 0x40, 0x40, 0x60, 0x40, 0x60, 0x49,
+    0x64, 0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x49, 0x64, 0x60, 0x64, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x40, 0x60, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x60, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x40, 0x60, 0x40, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x49, 0x60, 0x60, 0x60, 0x60, 0x40, 0x40, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x6D, 0x64, 0x60, 0x60, 0x40, 0x60, 0x60, 0x64, 0x6D,
+    0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x60, 0x64, 0x40, 0x64, 0x60, 0x40, 0x60, 0x49, 0x40, 0x60, 0x60, 0x60, 0x40, 0x60, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x60, 0x60, 0x60, 0x64, 0x60, 0x60, 0x64, 0x6D, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x64, 0x49,
+    0x60, 0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49, 0x64, 0x60, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x64, 0x40, 0x40, 0x64, 0x40, 0x60, 0x49, 0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x6D,
+    0x64, 0x60, 0x60, 0x40, 0x60, 0x40, 0x64, 0x49, 0x60, 0x60, 0x60, 0x60, 0x60, 0x64, 0x60, 0x49,
+    0x40, 0x60, 0x40, 0x60, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x40, 0x60, 0x60, 0x60, 0x49, 0x60, 0x40, 0x60, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x60, 0x64, 0x40, 0x60, 0x60, 0x49,
+    0x60, 0x40, 0x60, 0x60, 0x40, 0x60, 0x60, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x64, 0x60, 0x64, 0x64, 0x40, 0x64, 0x49, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x60, 0x60, 0x60, 0x60, 0x40, 0x49,
+    0x60, 0x60, 0x60, 0x64, 0x60, 0x64, 0x60, 0x49, 0x64, 0x40, 0x64, 0x60, 0x64, 0x60, 0x60, 0x49,
+    0x60, 0x40, 0x40, 0x60, 0x40, 0x60, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x64, 0x40, 0x64, 0x40, 0x60, 0x60, 0x49, 0x60, 0x60, 0x60, 0x40, 0x40, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x49,
+    0x60, 0x40, 0x60, 0x64, 0x64, 0x60, 0x60, 0x49, 0x60, 0x60, 0x60, 0x64, 0x64, 0x60, 0x60, 0x49,
+    0x40, 0x60, 0x60, 0x40, 0x40, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x60, 0x60, 0x60, 0x40, 0x60, 0x40, 0x60, 0x49, 0x64, 0x60, 0x60, 0x40, 0x40, 0x60, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x6D,
+    0x40, 0x60, 0x40, 0x40, 0x60, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x49,
+    0x40, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x60, 0x64, 0x49,
+    0x60, 0x40, 0x40, 0x40, 0x60, 0x60, 0x40, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49,
+    0x64, 0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x40, 0x60, 0x60, 0x60, 0x40, 0x60, 0x40, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49,
+    0x60, 0x60, 0x40, 0x60, 0x40, 0x40, 0x64, 0x49, 0x60, 0x60, 0x60, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x40, 0x40, 0x40, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x60, 0x49, 0x60, 0x60, 0x64, 0x64, 0x64, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x40, 0x60, 0x60, 0x60, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x49, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x64, 0x40, 0x60, 0x60, 0x64, 0x64, 0x60, 0x6D, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x60, 0x60, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x64, 0x64, 0x40, 0x60, 0x40, 0x60, 0x49, 0x64, 0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x60, 0x64, 0x60, 0x60, 0x6D, 0x64, 0x60, 0x64, 0x64, 0x64, 0x60, 0x60, 0x6D,
+    0x60, 0x60, 0x60, 0x40, 0x40, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x60, 0x49, 0x60, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x64, 0x64, 0x64, 0x60, 0x64, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x60, 0x60, 0x60, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x40, 0x64, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x40, 0x64, 0x64, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x64, 0x64, 0x60, 0x40, 0x6D, 0x64, 0x64, 0x60, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x64, 0x64, 0x60, 0x60, 0x64, 0x60, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x64, 0x60, 0x64, 0x60, 0x60, 0x60, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x64, 0x60, 0x64, 0x64, 0x60, 0x60, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x6D, 0x6D, 0x6D, 0x49, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x60, 0x49, 0x64, 0x64, 0x64, 0x60, 0x60, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D,
+    0x64, 0x40, 0x60, 0x40, 0x40, 0x60, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D,
+    0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x60, 0x49, 0x64, 0x60, 0x64, 0x60, 0x60, 0x60, 0x60, 0x49,
+    0x60, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x40, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x49, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x60, 0x40, 0x60, 0x40, 0x60, 0x49, 0x60, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x6D,
+    0x40, 0x40, 0x60, 0x60, 0x60, 0x40, 0x60, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x40, 0x40, 0x40, 0x40, 0x60, 0x60, 0x49, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x60, 0x64, 0x60, 0x49, 0x64, 0x60, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x40, 0x60, 0x64, 0x64, 0x60, 0x60, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x40, 0x6D, 0x64, 0x60, 0x64, 0x64, 0x60, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x64, 0x60, 0x40, 0x40, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x40, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x40, 0x64, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x60, 0x40, 0x40, 0x40, 0x60, 0x40, 0x60, 0x49, 0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x64, 0x64, 0x60, 0x60, 0x64, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x49, 0x60, 0x60, 0x40, 0x60, 0x60, 0x60, 0x40, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x60, 0x60, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x60, 0x64, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x60, 0x60, 0x60, 0x40, 0x40, 0x49, 0x60, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x40, 0x49, 0x40, 0x40, 0x60, 0x40, 0x60, 0x60, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x60, 0x60, 0x60, 0x60, 0x6D,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x40, 0x60, 0x64, 0x60, 0x40, 0x40, 0x49, 0x60, 0x60, 0x40, 0x40, 0x60, 0x40, 0x60, 0x49,
+    0x40, 0x40, 0x40, 0x60, 0x40, 0x60, 0x40, 0x49, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x60, 0x64, 0x64, 0x64, 0x49, 0x60, 0x64, 0x60, 0x60, 0x64, 0x64, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x60, 0x6D, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x40, 0x6D,
+    0x60, 0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x49, 0x40, 0x60, 0x60, 0x60, 0x40, 0x40, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x60, 0x60, 0x64, 0x64, 0x60, 0x64, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x40, 0x60, 0x60, 0x60, 0x60, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x60, 0x60, 0x40, 0x60, 0x60, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x60, 0x60, 0x40, 0x64, 0x64, 0x64, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x40, 0x60, 0x40, 0x40, 0x40, 0x60, 0x60, 0x6D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x60, 0x60, 0x40, 0x6D, 0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x60, 0x49,
+    0x64, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x6D, 0x60, 0x64, 0x64, 0x40, 0x64, 0x60, 0x60, 0x49,
+    0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x64, 0x40, 0x60, 0x60, 0x40, 0x40, 0x40, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60, 0x6D,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6D, 0x60, 0x64, 0x60, 0x60, 0x64, 0x64, 0x60, 0x49,
+    0x49, 0x49, 0x6D, 0x49, 0x49, 0x49, 0x49, 0x49, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x40, 0x60, 0x40, 0x40, 0x60, 0x40, 0x40, 0x49
+  },
+  { // stone (dim)
+    0x6D, 0x49, 0x49, 0x24, 0x24, 0x25, 0x49, 0x25, 0x24, 0x25, 0x49, 0x24, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x24,
+    0x6D, 0x49, 0x25, 0x24, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x6D, 0x24, 0x25, 0x24, 0x49, 0x25, 0x49, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x00,
+    0x6D, 0x49, 0x25, 0x24, 0x24, 0x24, 0x25, 0x49, 0x24, 0x25, 0x49, 0x24, 0x25, 0x00, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x00,
+    0x6D, 0x24, 0x49, 0x49, 0x25, 0x49, 0x24, 0x49, 0x24, 0x49, 0x49, 0x25, 0x24, 0x24, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x00, 0x24, 0x24,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24,
+    0x6D, 0x49, 0x49, 0x25, 0x25, 0x49, 0x25, 0x24, 0x49, 0x25, 0x49, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24,
+    0x6D, 0x49, 0x49, 0x25, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x24, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x6D, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x24, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x6D, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24,
+    0x6D, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x00,
+    0x6D, 0x25, 0x49, 0x24, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x24,
+    0x6D, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x49, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x00,
+    0x6D, 0x24, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x6D, 0x25, 0x49, 0x25, 0x25, 0x25, 0x49, 0x25, 0x24, 0x49, 0x25, 0x24, 0x49, 0x24, 0x49, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x49, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00,
+    0x6D, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x24,
+    0x6D, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0x49, 0x00, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24,
+    0x6D, 0x25, 0x25, 0x25, 0x49, 0x24, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0x49, 0x25,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x00,
+    0x6D, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x25, 0x00, 0x6D, 0x25,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00,
+    0x6D, 0x24, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x25,
+    0x49, 0x25, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x24,
+    0x6D, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x6D, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x00, 0x49, 0x25,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x25,
+    0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24,
+    0x6D, 0x25, 0x49, 0x24, 0x25, 0x49, 0x25, 0x25, 0x24, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00,
+    0x24, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x49,
+    0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00,
+    0x49, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x00, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24,
+    0x49, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x49, 0x25, 0x25, 0x25, 0x00, 0x6D, 0x25,
+    0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x49, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x00, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x00,
+    0x49, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x25, 0x49, 0x25, 0x24, 0x49, 0x25, 0x25, 0x49, 0x25, 0x49, 0x24, 0x00, 0x6D, 0x25,
+    0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x24,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x49, 0x24, 0x24, 0x24, 0x49, 0x25, 0x24, 0x24, 0x49, 0x24, 0x6D, 0x49,
+    0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x49, 0x24, 0x24, 0x25, 0x24, 0x49, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x24, 0x49, 0x25,
+    0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x49, 0x25, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x49, 0x25,
+    0x49, 0x24, 0x24, 0x49, 0x25, 0x24, 0x49, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x24,
+    0x49, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x25, 0x00, 0x49, 0x25,
+    0x25, 0x49, 0x24, 0x25, 0x24, 0x49, 0x25, 0x49, 0x24, 0x25, 0x25, 0x24, 0x25, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x00, 0x6D, 0x25,
+    0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x49, 0x24, 0x25, 0x24, 0x49, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x25, 0x25, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x00, 0x6D, 0x25,
+    0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x25,
+    0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x49, 0x49, 0x24, 0x25, 0x25, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x00,
+    0x49, 0x49, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x25,
+    0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x25, 0x49, 0x25, 0x25, 0x24, 0x49, 0x49,
+    0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x49, 0x24, 0x24, 0x49, 0x25, 0x00, 0x6D, 0x25,
+    0x49, 0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x24,
+    0x49, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x25, 0x25, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x25, 0x24, 0x24, 0x49, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x6D, 0x49,
+    0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x49, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x49, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x49, 0x24, 0x24, 0x25, 0x24, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x25, 0x25, 0x49, 0x49, 0x00,
+    0x49, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x24, 0x49, 0x25,
+    0x49, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x49, 0x25, 0x25, 0x00, 0x6D, 0x25,
+    0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00,
+    0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x49, 0x24, 0x25, 0x24, 0x25, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x00, 0x49, 0x49,
+    0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x49, 0x25, 0x25, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x49, 0x24, 0x24, 0x25, 0x25, 0x25, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x24, 0x00,
+    0x49, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x00, 0x24, 0x24,
+    0x00, 0x00, 0x24, 0x00, 0x24, 0x24, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x49, 0x24,
+    0x25, 0x25, 0x49, 0x25, 0x49, 0x25, 0x24, 0x24, 0x25, 0x49, 0x25, 0x25, 0x25, 0x00, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00,
+    0x24, 0x00, 0x24, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x24, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x49,
+    0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x24, 0x6D, 0x49,
+    0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24,
+    0x49, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24,
+    0x49, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x25, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x25,
+    0x49, 0x49, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x49,
+    0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x25, 0x25, 0x00, 0x49, 0x25,
+    0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x25,
+    0x49, 0x25, 0x49, 0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x00, 0x49, 0x25,
+    0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x00,
+    0x49, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x49, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x00, 0x49, 0x25,
+    0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x6D, 0x25,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x25, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x49, 0x24,
+    0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x24, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0x49, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x00, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x00, 0x49, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x00,
+    0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x49, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x00,
+    0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x24, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x49, 0x49, 0x25, 0x00, 0x6D, 0x49,
+    0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x6D, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x25, 0x49, 0x49, 0x25, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x24
+  },
+  { // wood (dim)
+    0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24,
+    0x20, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20,
+    0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44,
+    0x20, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44, 0x64, 0x44, 0x24, 0x44, 0x44, 0x64, 0x64, 0x44, 0x24,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x64,
+    0x44, 0x24, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x64, 0x44, 0x64, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x64, 0x24, 0x24, 0x24, 0x64, 0x44, 0x44, 0x64, 0x64, 0x64, 0x44, 0x64, 0x64, 0x44,
+    0x64, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x64, 0x64,
+    0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x64, 0x44, 0x44, 0x64, 0x64, 0x44, 0x44, 0x44, 0x64,
+    0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x24, 0x24, 0x44, 0x64, 0x64, 0x64, 0x64, 0x44, 0x44, 0x64,
+    0x64, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64, 0x44, 0x64, 0x64,
+    0x44, 0x64, 0x64, 0x64, 0x44, 0x24, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x64,
+    0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x24, 0x24, 0x64, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x64,
+    0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x24, 0x64,
+    0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x24, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x64, 0x64, 0x64, 0x24,
+    0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44, 0x64,
+    0x44, 0x64, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x64, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64,
+    0x44, 0x64, 0x64, 0x44, 0x44, 0x64, 0x24, 0x44, 0x24, 0x24, 0x64, 0x44, 0x64, 0x64, 0x44, 0x64,
+    0x44, 0x64, 0x64, 0x44, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x64, 0x64, 0x44, 0x24, 0x44, 0x64, 0x44, 0x44, 0x64, 0x24,
+    0x24, 0x44, 0x64, 0x64, 0x64, 0x64, 0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64, 0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x64,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64, 0x64, 0x44, 0x64, 0x44, 0x64, 0x64, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44,
+    0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x64, 0x44,
+    0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64, 0x44, 0x64, 0x64,
+    0x24, 0x24, 0x44, 0x44, 0x64, 0x64, 0x44, 0x24, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x64, 0x44,
+    0x44, 0x44, 0x24, 0x44, 0x64, 0x44, 0x64, 0x64, 0x44, 0x24, 0x24, 0x44, 0x44, 0x64, 0x64, 0x64,
+    0x44, 0x64, 0x44, 0x64, 0x44, 0x24, 0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64,
+    0x44, 0x44, 0x44, 0x64, 0x64, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64, 0x44, 0x44, 0x24, 0x24, 0x44,
+    0x44, 0x64, 0x64, 0x64, 0x44, 0x44, 0x44, 0x64, 0x64, 0x44, 0x64, 0x44, 0x24, 0x24, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x24, 0x24, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x24,
+    0x24, 0x44, 0x44, 0x64, 0x64, 0x64, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64,
+    0x44, 0x64, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44,
+    0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64,
+    0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44,
+    0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44,
+    0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x64, 0x44, 0x64, 0x44,
+    0x24, 0x44, 0x64, 0x44, 0x64, 0x44, 0x64, 0x64, 0x64, 0x44, 0x64, 0x24, 0x24, 0x64, 0x44, 0x44,
+    0x64, 0x24, 0x44, 0x24, 0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64,
+    0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x64, 0x44,
+    0x64, 0x64, 0x44, 0x44, 0x64, 0x64, 0x44, 0x64, 0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64,
+    0x24, 0x24, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x64, 0x44, 0x64, 0x64, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x64, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44,
+    0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x64,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x44, 0x64, 0x64, 0x64, 0x44, 0x24, 0x24, 0x44, 0x24, 0x44,
+    0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44,
+    0x44, 0x64, 0x64, 0x64, 0x44, 0x44, 0x44, 0x64, 0x44, 0x44, 0x64, 0x64, 0x44, 0x64, 0x64, 0x44,
+    0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x64, 0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x64, 0x64, 0x64,
+    0x64, 0x44, 0x64, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x64, 0x64, 0x64, 0x64, 0x44, 0x44, 0x44,
+    0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x64, 0x44, 0x64, 0x44, 0x44, 0x64,
+    0x44, 0x64, 0x44, 0x64, 0x44, 0x44, 0x44, 0x64, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44,
+    0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24, 0x44, 0x24, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24,
+    0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x44, 0x20, 0x20,
+    0x44, 0x24, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x44,
+    0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24,
+    0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44,
+    0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x24, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44,
+    0x20, 0x20, 0x44, 0x24, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44,
+    0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44,
+    0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24, 0x44, 0x44, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x24,
+    0x20, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x44, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24,
+    0x24, 0x24, 0x24, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44,
+    0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24, 0x24, 0x44,
+    0x44, 0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44,
+    0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x24, 0x44, 0x24, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44,
+    0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x24,
+    0x44, 0x24, 0x24, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24,
+    0x24, 0x44, 0x44, 0x24, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x24, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x24, 0x24, 0x44, 0x24, 0x20, 0x20,
+    0x44, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x44, 0x24, 0x24, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x24, 0x44,
+    0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24,
+    0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x44, 0x20, 0x20, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x24,
+    0x24, 0x24, 0x24, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44,
+    0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x24,
+    0x44, 0x24, 0x24, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24,
+    0x44, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24,
+    0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x44,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x24, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20,
+    0x24, 0x24, 0x44, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44,
+    0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x20, 0x20, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x24, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24, 0x44,
+    0x24, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x44, 0x24, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44,
+    0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x24, 0x24, 0x20, 0x20, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x24,
+    0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44,
+    0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44,
+    0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24,
+    0x20, 0x24, 0x44, 0x24, 0x24, 0x44, 0x24, 0x44, 0x24, 0x24, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44,
+    0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x24, 0x44,
+    0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x24, 0x24, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44,
+    0x24, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x24, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x24, 0x44, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x44, 0x24, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x24, 0x44, 0x24, 0x44, 0x44,
+    0x24, 0x24, 0x44, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x44, 0x44, 0x24, 0x44, 0x44, 0x20, 0x20, 0x24, 0x44,
+    0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x20, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x20,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24, 0x24, 0x44, 0x44, 0x24, 0x44, 0x44,
+    0x24, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x24, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x24,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x44, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // exit (dim)
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C
+  }
+};
@@ -0,0 +1,72 @@
+#pragma once
+// Seedable PRNG streams
+// xoshiro128** — 128 bits of state, four 32-bit ops per number, no
+// multiplies beyond two constant ones, which suits the ESP32-S3's 32-bit
+// core. Each mode owns a Prng, so streams are independent of each other
+// and of call order elsewhere, and a fixed seed replays a mode exactly.
+//
+// Arduino's random(lo, hi) reads the hardware RNG (esp_random) and
+// reduces with a modulo on every call. prngRange maps with one 32x32->64
+// multiply instead (Lemire), branch-free; its bias is below range/2^32,
+// invisible for screen-sized ranges.
+
+#include <stdint.h>
+#include <string.h>
+
+struct Prng {
+  uint32_t s[4];
+};
+
+static inline uint32_t prngRotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+// splitmix32 step: expands a seed into well-mixed state words
+static inline uint32_t prngMix(uint32_t& z) {
+  z += 0x9E3779B9u;
+  uint32_t x = z;
+  x = (x ^ (x >> 16)) * 0x85EBCA6Bu;
+  x = (x ^ (x >> 13)) * 0xC2B2AE35u;
+  return x ^ (x >> 16);
+}
+
+// Same seed + different stream ids give unrelated sequences
+static void prngSeed(Prng& p, uint32_t seed, uint32_t stream = 0) {
+  uint32_t z = seed ^ prngRotl(stream * 0x9E3779B9u, 16);
+  for (int i = 0; i < 4; i++) p.s[i] = prngMix(z);
+  if (!(p.s[0] | p.s[1] | p.s[2] | p.s[3])) p.s[0] = 1;  // all-zero state is a fixed point
+}
+
+static inline uint32_t prngNext(Prng& p) {
+  uint32_t* s = p.s;
+  uint32_t r = prngRotl(s[1] * 5, 7) * 9;
+  uint32_t t = s[1] << 9;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = prngRotl(s[3], 11);
+  return r;
+}
+
+// [0, n)
+static inline uint32_t prngBelow(Prng& p, uint32_t n) {
+  return (uint32_t)(((uint64_t)prngNext(p) * n) >> 32);
+}
+
+// [lo, hi), same contract as Arduino random(lo, hi)
+static inline int32_t prngRange(Prng& p, int32_t lo, int32_t hi) {
+  return lo + (int32_t)prngBelow(p, (uint32_t)(hi - lo));
+}
+
+// Fill n bytes, four per generator step
+static inline void prngFill(Prng& p, void* dst, size_t n) {
+  uint8_t* d = (uint8_t*)dst;
+  for (; n >= 4; n -= 4, d += 4) {
+    uint32_t r = prngNext(p);
+    memcpy(d, &r, 4);
+  }
+  if (n) {
+    uint32_t r = prngNext(p);
+    memcpy(d, &r, n);
+  }
+}
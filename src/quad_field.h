@@ -0,0 +1,63 @@
+#pragma once
+// Quadrant-symmetric per-pixel fields
+// A W x H field that only depends on |x - W/2| and |y - H/2| (distance
+// from center, rings, radial falloff) is stored as one (W/2+1) x (H/2+1)
+// quadrant and mirrored on lookup. For a 320x240 screen that is 161x121
+// bytes (19.5 KB), small enough for internal SRAM, instead of a 76.8 KB
+// full-frame table that has to live in PSRAM.
+//
+// Hot loops should fetch row(y) once per scanline and walk it with
+// |dx|: backwards over the left half, forwards over the right half.
+// T can be wider than a byte to pack several per-pixel terms into one
+// load (e.g. the tunnel's angle and depth).
+
+#include <stdint.h>
+
+template <int W, int H, typename T = uint8_t>
+struct QuadField {
+  static const int QW = W / 2 + 1;  // dx spans -W/2 .. W/2-1
+  static const int QH = H / 2 + 1;
+  T q[QH][QW];
+
+  // Quadrant row for screen row y, indexed by |x - W/2|
+  const T* row(int y) const {
+    int dy = y - H / 2;
+    return q[dy < 0 ? -dy : dy];
+  }
+
+  T at(int x, int y) const {
+    int dx = x - W / 2;
+    return row(y)[dx < 0 ? -dx : dx];
+  }
+
+  // Expand one screen row into out[0..W)
+  void expandRow(int y, T* out) const {
+    const T* r = row(y);
+    for (int x = 0; x < W / 2; x++) out[x] = r[W / 2 - x];
+    for (int x = W / 2; x < W; x++) out[x] = r[x - W / 2];
+  }
+
+  // q[dy][dx] = fn(dx, dy) for the quadrant only
+  template <typename F>
+  void build(F fn) {
+    for (int dy = 0; dy < QH; dy++) {
+      for (int dx = 0; dx < QW; dx++) q[dy][dx] = fn(dx, dy);
+    }
+  }
+
+  // q[dy][dx] = floor(sqrt(dx² + dy²)) & 0xFF with no sqrt or multiply
+  // in the loop: along a row r² grows by 2dx+1 and d only steps upward,
+  // tracking (d+1)² the same way.
+  void buildDistance() {
+    for (int dy = 0; dy < QH; dy++) {
+      int d = dy;
+      int r2 = dy * dy;
+      int next = (d + 1) * (d + 1);
+      for (int dx = 0; dx < QW; dx++) {
+        while (next <= r2) { next += 2 * d + 3; d++; }
+        q[dy][dx] = (T)d;
+        r2 += 2 * dx + 1;
+      }
+    }
+  }
+};
@@ -0,0 +1,123 @@
+#pragma once
+// Strip renderer
+// A mode that computes every pixel afresh each frame, with nothing carried
+// over from the last one, doesn't need a frame buffer. It renders STRIP_H
+// rows at a time, and each strip goes out over SPI DMA while the next one
+// renders, so render and push overlap instead of adding up.
+//
+// The mode writes 8-bit values (RGB332 or palette indices) into a scratch
+// band, then one table lookup per pixel turns them into the panel's
+// byte-swapped RGB565. The push would otherwise do that conversion on the
+// CPU, and with it in a table the output palette and the fade brightness
+// come for free. Two output bands alternate: the bus only starts a
+// transfer once the previous one has finished, so when pushImageDMA()
+// returns for strip n, strip n - 1's band can be written again.
+//
+// A mode that keeps its 8-bit frame (genart's palette-cycled plasma and
+// moiré) can hand its own rows to stripsPushFrom() instead, and push
+// palette-only frames without rendering anything.
+//
+// Everything lives in internal SRAM, about 26 KB at 320x16. The output
+// bands have to be DMA-capable, so there is no PSRAM fallback: if they
+// can't be allocated, stripsReady() stays false and the app keeps using
+// its full-frame sprites. Include after M5Unified.h (lgfx::swap565_t).
+//
+// The bands are allocated first, so their 26 KB is internal RAM the
+// full-frame sprites (2 x 75 KB, allocated when the first non-strip mode
+// starts) can't have. If the sprites then don't fit in SRAM they fall
+// back to PSRAM, and the modes that read their last frame back (trails,
+// diffDraw) run slower for it. STRIP_RENDER 0 gives that RAM back.
+
+#include <stdint.h>
+#include <string.h>
+#include "jobs.h"
+
+#ifndef STRIP_RENDER
+#define STRIP_RENDER 1
+#endif
+#define STRIP_W 320
+#define STRIP_H 16  // rows per strip; must divide the screen height
+
+struct Strips {
+  uint16_t* out[2];                // panel pixels, DMA-capable SRAM
+  uint8_t src[STRIP_W * STRIP_H];  // the mode's rows for the current strip
+  uint16_t lut[256];               // src value -> panel pixel
+  uint8_t pal[256];                // src value -> RGB332, as loaded
+  uint8_t kept[STRIP_W];           // one row as RGB332, for the NeoPixels
+};
+
+static Strips _strips;
+
+static bool stripsReady() {
+  return _strips.out[0] && _strips.out[1];
+}
+
+// Allocate the output bands; call before the full-frame sprites so the
+// bands get internal RAM first (see above for what that costs)
+static bool stripsBegin() {
+#if STRIP_RENDER
+  for (int i = 0; i < 2; i++) {
+    if (!_strips.out[i]) {
+      _strips.out[i] = (uint16_t*)heap_caps_malloc(STRIP_W * STRIP_H * sizeof(uint16_t),
+                                                   MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    }
+  }
+#endif
+  return stripsReady();
+}
+
+// Load the output palette: src value i is shown as RGB332 pal[i]. Top bits
+// are replicated so full-scale RGB332 maps to full-scale RGB565.
+static void stripsPalette(const uint8_t* pal) {
+  memcpy(_strips.pal, pal, 256);
+  for (int i = 0; i < 256; i++) {
+    uint8_t c = pal[i];
+    uint16_t r = (c >> 5) * 0x24 >> 3;      // 3 -> 5 bits
+    uint16_t g = ((c >> 2) & 7) * 0x49 >> 3;  // 3 -> 6 bits
+    uint16_t b = (c & 3) * 0x15 >> 1;       // 2 -> 5 bits
+    uint16_t v = (r << 11) | (g << 5) | b;
+    _strips.lut[i] = (uint16_t)((v >> 8) | (v << 8));
+  }
+}
+
+// Render and push a frame of height rows. rows(y0, y1) returns screen
+// rows [y0, y1), STRIP_W bytes per row, to convert: rendered into the
+// scratch band or kept elsewhere, as long as they stay put until the call
+// returns. It runs on both cores like a jobsFor kernel. Row keepY is
+// saved to _strips.kept. Returns the time spent rendering in us; the rest
+// of the call is waiting on the bus.
+template <class Display, class F>
+static uint32_t stripsPushFrom(Display& lcd, int height, int keepY, F rows) {
+  uint32_t renderUs = 0;
+  for (int y = 0, n = 0; y < height; y += STRIP_H, n ^= 1) {
+    uint32_t t0 = micros();
+    uint16_t* out = _strips.out[n];
+    jobsFor(STRIP_H, [&](int r0, int r1) {
+      const uint8_t* src = rows(y + r0, y + r1);
+      if (keepY >= y + r0 && keepY < y + r1) {
+        const uint8_t* k = src + (keepY - y - r0) * STRIP_W;
+        for (int x = 0; x < STRIP_W; x++) _strips.kept[x] = _strips.pal[k[x]];
+      }
+      const uint16_t* lut = _strips.lut;
+      uint32_t* dst = (uint32_t*)(out + r0 * STRIP_W);
+      for (int i = 0; i < (r1 - r0) * STRIP_W; i += 2) {
+        *dst++ = lut[src[i]] | ((uint32_t)lut[src[i + 1]] << 16);
+      }
+    });
+    renderUs += micros() - t0;
+    lcd.pushImageDMA(0, y, STRIP_W, STRIP_H, (const lgfx::swap565_t*)out);
+  }
+  lcd.waitDMA();
+  return renderUs;
+}
+
+// stripsPushFrom() for modes that render every strip afresh: rows(dst,
+// y0, y1) fills screen rows [y0, y1) at dst in the scratch band
+template <class Display, class F>
+static uint32_t stripsPush(Display& lcd, int height, int keepY, F rows) {
+  return stripsPushFrom(lcd, height, keepY, [&](int y0, int y1) {
+    uint8_t* dst = _strips.src + (y0 % STRIP_H) * STRIP_W;
+    rows(dst, y0, y1);
+    return (const uint8_t*)dst;
+  });
+}
@@ -0,0 +1,23 @@
+#pragma once
+// Minimal assertions for the host tests: CHECK counts failures (printing
+// the first few), testExit() reports and turns the count into the exit code.
+
+#include <stdio.h>
+
+static int _testFailures = 0;
+
+#define CHECK(cond, ...)                                    \
+  do {                                                      \
+    if (!(cond)) {                                          \
+      if (_testFailures++ < 10) {                           \
+        printf("FAIL %s:%d: ", __FILE__, __LINE__);         \
+        printf(__VA_ARGS__);                                \
+        printf("\n");                                       \
+      }                                                     \
+    }                                                       \
+  } while (0)
+
+static inline int testExit(const char* name) {
+  printf("%s: %s (%d failures)\n", name, _testFailures ? "FAILED" : "ok", _testFailures);
+  return _testFailures ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+// Host test for fastmath.h: asserts the error bounds documented in the
+// header against libm, so a regenerated fastmath_tables.h can't quietly
+// break them. Sweeps every fmSin/fmCos angle, an fmAtan2 grid, fmRecip
+// and fmIsqrt over dense low ranges plus random 32-bit inputs, and all
+// 256 fmHue332 entries against the float HSV conversion they replaced.
+
+#include "fastmath.h"
+#include "check.h"
+#include <math.h>
+#include <random>
+
+static const double kTwoPi = 6.283185307179586;
+
+// The float conversion fmHue332 replaced (screensavers' hsvToRgb332)
+static uint8_t rgb332(uint8_t r, uint8_t g, uint8_t b) {
+  return (r & 0xE0) | ((g >> 3) & 0x1C) | (b >> 6);
+}
+
+static uint8_t hsvToRgb332(float h, float s, float v) {
+  float c = v * s;
+  float x = c * (1.0f - fabsf(fmodf(h / 60.0f, 2.0f) - 1.0f));
+  float m = v - c;
+  float rf, gf, bf;
+  if (h < 60)       { rf = c; gf = x; bf = 0; }
+  else if (h < 120) { rf = x; gf = c; bf = 0; }
+  else if (h < 180) { rf = 0; gf = c; bf = x; }
+  else if (h < 240) { rf = 0; gf = x; bf = c; }
+  else if (h < 300) { rf = x; gf = 0; bf = c; }
+  else               { rf = c; gf = 0; bf = x; }
+  return rgb332((uint8_t)((rf + m) * 255), (uint8_t)((gf + m) * 255), (uint8_t)((bf + m) * 255));
+}
+
+static void testSinCos() {
+  double worst = 0;
+  for (uint32_t a = 0; a < FM_TURN; a++) {
+    double rad = a * kTwoPi / FM_TURN;
+    double es = fabs(fmSin((uint16_t)a) - sin(rad) * FM_ONE);
+    double ec = fabs(fmCos((uint16_t)a) - cos(rad) * FM_ONE);
+    CHECK(es <= 2.0, "fmSin(%u) off by %.2f LSB", a, es);
+    CHECK(ec <= 2.0, "fmCos(%u) off by %.2f LSB", a, ec);
+    worst = fmax(worst, fmax(es, ec));
+  }
+  printf("fmSin/fmCos: worst %.2f LSB (bound 2)\n", worst);
+}
+
+static void testAtan2() {
+  double worst = 0;
+  auto check = [&](int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return;
+    double ref = atan2((double)y, (double)x) * FM_TURN / kTwoPi;
+    double e = fabs(fmAtan2(y, x) - ref);
+    if (e > FM_TURN / 2) e = FM_TURN - e;  // wrap across angle 0
+    CHECK(e <= 18.0, "fmAtan2(%d, %d) off by %.1f units", y, x, e);
+    worst = fmax(worst, e);
+  };
+  for (int32_t y = -400; y <= 400; y++) {
+    for (int32_t x = -400; x <= 400; x++) check(y, x);
+  }
+  std::mt19937 rng(35);
+  for (int i = 0; i < 1000000; i++) {
+    check((int32_t)(rng() >> 1) - (1 << 30), (int32_t)(rng() >> 1) - (1 << 30));
+  }
+  printf("fmAtan2: worst %.2f units (bound 18)\n", worst);
+}
+
+static void testRecip() {
+  double worst = 0;
+  auto check = [&](uint32_t d) {
+    double ref = 4294967296.0 / d;
+    double e = fabs((double)fmRecip(d) - ref);
+    double bound = ref / (1 << 18) + 1;
+    CHECK(e <= bound, "fmRecip(%u) off by %.3f, bound %.3f", d, e, bound);
+    worst = fmax(worst, (e - 1 > 0 ? e - 1 : 0) / ref);
+  };
+  for (uint32_t d = 2; d < (1u << 22); d++) check(d);
+  std::mt19937 rng(35);
+  for (int i = 0; i < 2000000; i++) {
+    uint32_t d = rng() >> (rng() % 31);
+    if (d >= 2) check(d);
+  }
+  check(0xFFFFFFFFu);
+  CHECK(fmRecip(0) == 0xFFFFFFFFu && fmRecip(1) == 0xFFFFFFFFu, "fmRecip(0/1) should saturate");
+  printf("fmRecip: worst %.4g relative, after the +1 (bound %.4g)\n", worst, 1.0 / (1 << 18));
+}
+
+static void testIsqrt() {
+  auto check = [&](uint32_t n) {
+    uint64_t r = fmIsqrt(n);
+    CHECK(r * r <= n && (r + 1) * (r + 1) > n, "fmIsqrt(%u) = %u", n, (unsigned)r);
+  };
+  for (uint32_t n = 0; n < (1u << 24); n++) check(n);
+  std::mt19937 rng(35);
+  for (int i = 0; i < 2000000; i++) check(rng());
+  for (uint32_t r = 65535; r > 65500; r--) {
+    check(r * r);
+    check(r * r - 1);
+  }
+  check(0xFFFFFFFFu);
+  printf("fmIsqrt: exact\n");
+}
+
+static void testHue() {
+  int diff = 0;
+  for (int i = 0; i < 256; i++) {
+    uint8_t ref = hsvToRgb332(i * 360.0f / 256, 1.0f, 1.0f);
+    CHECK(fmHue332[i] == ref, "fmHue332[%d] = 0x%02X, float conversion 0x%02X", i, fmHue332[i], ref);
+    diff += fmHue332[i] != ref;
+  }
+  printf("fmHue332: %d of 256 entries differ (bound 0)\n", diff);
+}
+
+int main() {
+  testSinCos();
+  testAtan2();
+  testRecip();
+  testIsqrt();
+  testHue();
+  return testExit("fastmath_test");
+}
@@ -0,0 +1,184 @@
+// Golden test for the screensaver's fixed-point motion: builds src/main.cpp
+// against the host stubs, runs the Toasters, Mystify and Bounce updates
+// from fixed seeds, and compares the drawn integer positions with the float
+// code they replaced, replayed from the same PRNG draws.
+//
+// Tolerances (measured over SEEDS seeds; the float code drew at (int)x,
+// which truncates, Px::toInt() floors, so left of or above the screen the
+// two are a pixel apart even on the same path):
+//   Bounce   same position (all multiples of 0.5 px, exact in both) and
+//            colour for BOUNCE_FRAMES frames
+//   Toasters within 2 px + frame / 128 of the float path until the flyer
+//            first wraps: each velocity component is rounded to 1/64 px, so
+//            it is off by at most 1/128 px per frame. After a wrap the
+//            respawn draws come in a different order.
+//   Mystify  within MYST_TOL px over MYST_FRAMES frames; a vertex that
+//            reaches a wall a frame earlier or later than the float one
+//            carries that offset until its next bounce, so this grows with
+//            the horizon rather than staying at quantisation size
+
+#include "../src/main.cpp"
+#include "check.h"
+
+#define SEEDS 16
+#define BOUNCE_FRAMES 2000
+#define TOASTER_FRAMES 600
+#define MYST_FRAMES 100
+#define MYST_TOL 5
+
+static uint8_t frameBuf[SCR_W * SCR_H];
+
+static int absi(int v) { return v < 0 ? -v : v; }
+
+// ---- the float versions, as they were before the Px migration ----
+
+struct RefFlyer {
+  float x, y, vx, vy;
+  bool wrapped;
+};
+
+struct RefShape {
+  float x[MYSTIFY_VERTS], y[MYSTIFY_VERTS];
+  float vx[MYSTIFY_VERTS], vy[MYSTIFY_VERTS];
+};
+
+static void testToasters(uint32_t seed, int& worst) {
+  Prng rng;
+  prngSeed(rng, seed, MODE_TOASTERS);
+  rngToasters = rng;
+  initToasters();
+
+  RefFlyer ref[MAX_FLYERS];
+  for (int i = 0; i < MAX_FLYERS; i++) {
+    RefFlyer& f = ref[i];
+    f.x = prngRange(rng, 0, SCR_W + 100);
+    f.y = prngRange(rng, -100, SCR_H);
+    float speed = 1.0f + prngRange(rng, 0, 20) * 0.1f;
+    f.vx = -speed;
+    f.vy = speed * 0.6f;
+    prngRange(rng, 0, NUM_TOASTER_FRAMES);
+    prngRange(rng, 3, 8);
+    f.wrapped = false;
+  }
+
+  flyerCount = MAX_FLYERS;
+  PxVec last[MAX_FLYERS];
+  for (int frame = 0; frame < TOASTER_FRAMES; frame++) {
+    for (int i = 0; i < MAX_FLYERS; i++) last[i] = flyers[i].pos;
+    renderToasters(frameBuf);
+    for (int i = 0; i < MAX_FLYERS; i++) {
+      RefFlyer& f = ref[i];
+      if (f.wrapped) continue;
+      f.x += f.vx;
+      f.y += f.vy;
+      uint8_t fw = flyers[i].isToast ? toastFrame.w : toasterFrames[0].w;
+      // Stop at the first wrap in either model
+      PxVec p = flyers[i].pos, q = last[i] + flyers[i].vel;
+      if (f.x < -fw - 10 || f.y > SCR_H + 10 || p.x != q.x || p.y != q.y) {
+        f.wrapped = true;
+        continue;
+      }
+      int dx = absi(p.x.toInt() - (int)f.x), dy = absi(p.y.toInt() - (int)f.y);
+      if (dx > worst) worst = dx;
+      if (dy > worst) worst = dy;
+      int tol = 2 + (frame + 1) / 128;
+      CHECK(dx <= tol && dy <= tol, "toasters seed %u frame %d flyer %d: (%d,%d) vs (%d,%d)",
+            seed, frame, i, p.x.toInt(), p.y.toInt(), (int)f.x, (int)f.y);
+    }
+  }
+}
+
+static void testMystify(uint32_t seed, int& worst) {
+  Prng rng;
+  prngSeed(rng, seed, MODE_MYSTIFY);
+  rngMystify = rng;
+  initMystify();
+
+  RefShape ref[MYSTIFY_SHAPES];
+  for (int s = 0; s < MYSTIFY_SHAPES; s++) {
+    RefShape& m = ref[s];
+    prngNext(rng);
+    prngRange(rng, 0, 10);
+    for (int v = 0; v < MYSTIFY_VERTS; v++) {
+      m.x[v] = prngRange(rng, 10, SCR_W - 10);
+      m.y[v] = prngRange(rng, 10, SCR_H - 10);
+      m.vx[v] = (prngRange(rng, 0, 2) ? 1.0f : -1.0f) * (1.5f + prngRange(rng, 0, 20) * 0.1f);
+      m.vy[v] = (prngRange(rng, 0, 2) ? 1.0f : -1.0f) * (1.5f + prngRange(rng, 0, 20) * 0.1f);
+    }
+  }
+
+  mystCount = MYSTIFY_SHAPES;
+  memset(frameBuf, 0, sizeof(frameBuf));
+  for (int frame = 0; frame < MYST_FRAMES; frame++) {
+    renderMystify(frameBuf);
+    for (int s = 0; s < MYSTIFY_SHAPES; s++) {
+      RefShape& m = ref[s];
+      for (int v = 0; v < MYSTIFY_VERTS; v++) {
+        m.x[v] += m.vx[v];
+        m.y[v] += m.vy[v];
+        if (m.x[v] <= 0 || m.x[v] >= SCR_W - 1) {
+          m.vx[v] = -m.vx[v];
+          m.x[v] = m.x[v] <= 0 ? 0 : SCR_W - 1;
+        }
+        if (m.y[v] <= 0 || m.y[v] >= SCR_H - 1) {
+          m.vy[v] = -m.vy[v];
+          m.y[v] = m.y[v] <= 0 ? 0 : SCR_H - 1;
+        }
+        const PxVec& p = mystShapes[s].pos[v];
+        int dx = absi(p.x.toInt() - (int)m.x[v]), dy = absi(p.y.toInt() - (int)m.y[v]);
+        if (dx > worst) worst = dx;
+        if (dy > worst) worst = dy;
+        CHECK(dx <= MYST_TOL && dy <= MYST_TOL, "mystify seed %u frame %d shape %d vertex %d: (%d,%d) vs (%d,%d)",
+              seed, frame, s, v, p.x.toInt(), p.y.toInt(), (int)m.x[v], (int)m.y[v]);
+      }
+    }
+  }
+}
+
+static void testBounce(uint32_t seed) {
+  Prng rng;
+  prngSeed(rng, seed, MODE_BOUNCE);
+  rngBounce = rng;
+  initBounce();
+
+  float x = prngRange(rng, 0, SCR_W - DVD_LOGO_W);
+  float y = prngRange(rng, 0, SCR_H - DVD_LOGO_H);
+  float vx = 2.0f, vy = 1.5f;
+  int colorIdx = 0;
+  for (int frame = 0; frame < BOUNCE_FRAMES; frame++) {
+    renderBounce(frameBuf);
+    x += vx;
+    y += vy;
+    bool bounced = false;
+    if (x <= 0) { vx = fabsf(vx); bounced = true; }
+    if (x >= SCR_W - DVD_LOGO_W) { vx = -fabsf(vx); bounced = true; }
+    if (y <= 0) { vy = fabsf(vy); bounced = true; }
+    if (y >= SCR_H - DVD_LOGO_H) { vy = -fabsf(vy); bounced = true; }
+    if (bounced) colorIdx = (colorIdx + 1) % NUM_RAINBOW;
+    const PxVec& p = dvdLogo.pos;
+    CHECK(p.x.toFloat() == x && p.y.toFloat() == y && dvdLogo.colorIdx == colorIdx,
+          "bounce seed %u frame %d: (%.2f,%.2f) colour %d vs (%.2f,%.2f) colour %d", seed, frame, p.x.toFloat(),
+          p.y.toFloat(), dvdLogo.colorIdx, x, y, colorIdx);
+  }
+}
+
+// Px * int wraps like the 16-bit integer instead of overflowing int
+static void testScale() {
+  CHECK((Px::fromRaw(INT16_MIN) * -1).raw == INT16_MIN, "Px(min) * -1");
+  CHECK((Px::fromRaw(-1) * -1).raw == 1, "Px(-1) * -1");
+  CHECK((Px::fromRaw(300) * 300).raw == (int16_t)(uint16_t)90000, "Px(300) * 300");
+  CHECK((Px::fromRaw(-32767) * 65535).raw == (int16_t)(uint16_t)(-32767 * 65535u), "Px(-32767) * 65535");
+}
+
+int main() {
+  int toasterWorst = 0, mystWorst = 0;
+  for (uint32_t seed = 1; seed <= SEEDS; seed++) {
+    testToasters(seed * 0x9E3779B9u, toasterWorst);
+    testMystify(seed * 0x9E3779B9u, mystWorst);
+    testBounce(seed * 0x9E3779B9u);
+  }
+  testScale();
+  printf("toasters worst %d px over %d frames, mystify worst %d px over %d frames (tol %d)\n", toasterWorst,
+         TOASTER_FRAMES, mystWorst, MYST_FRAMES, MYST_TOL);
+  return testExit("fixed_golden_test");
+}
@@ -0,0 +1,76 @@
+// Host test for jobs.h: every row of a jobsFor range is visited exactly
+// once, for awkward counts and bands, and the output of a plasma-like
+// kernel matches a serial run. Also prints the speedup over zero workers
+// (jobsFor before jobsBegin(), which is what JOB_HOST_THREADS=0 gives).
+// The speedup needs a second free core; it is reported, not asserted.
+
+#include "jobs.h"
+#include "check.h"
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <vector>
+
+#define W 320
+#define H 240
+
+static uint8_t sinTab[256], pal[256];
+
+// Plasma-like: a few table lookups per pixel, one byte store
+static void plasmaRows(uint8_t* buf, int t, int y0, int y1) {
+  for (int y = y0; y < y1; y++) {
+    uint8_t base = sinTab[(y + t) & 255];
+    for (int x = 0; x < W; x++) {
+      uint8_t v = sinTab[(x + t) & 255] + base + sinTab[((x + y + t) >> 1) & 255];
+      buf[y * W + x] = pal[sinTab[v]];
+    }
+  }
+}
+
+static double frameUs(std::vector<uint8_t>& buf, int frames) {
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) {
+    jobsFor(H, [&](int y0, int y1) { plasmaRows(buf.data(), f, y0, y1); });
+  }
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+}
+
+static void checkCoverage() {
+  static std::atomic<int> hits[1024];
+  const int counts[] = { 1, 7, 8, 9, 63, 240, 241, 1000 };
+  const int bands[] = { 1, 3, 8, 16, 64 };
+  for (int run = 0; run < 200; run++) {
+    for (int count : counts) {
+      for (int band : bands) {
+        for (int i = 0; i < count; i++) hits[i].store(0);
+        jobsFor(count, [&](int b, int e) {
+          // One inline call covers the whole range when there are no workers
+          bool whole = b == 0 && e == count;
+          CHECK(b >= 0 && b < e && e <= count && (e - b <= band || whole), "band [%d, %d) of %d/%d", b, e, count, band);
+          for (int i = b; i < e; i++) hits[i].fetch_add(1);
+        }, band);
+        for (int i = 0; i < count; i++) {
+          CHECK(hits[i].load() == 1, "row %d of %d (band %d) visited %d times", i, count, band, hits[i].load());
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  for (int i = 0; i < 256; i++) {
+    sinTab[i] = (uint8_t)(127.0f * sinf(i * 6.2831853f / 256) + 128);
+    pal[i] = (uint8_t)(i * 7);
+  }
+  std::vector<uint8_t> serial(W * H), parallel(W * H);
+
+  double serialUs = frameUs(serial, 200);  // no workers yet: runs inline
+  jobsBegin();
+  double parallelUs = frameUs(parallel, 200);
+  CHECK(serial == parallel, "parallel frame differs from serial");
+  checkCoverage();
+
+  printf("plasma 320x240: %.0f us serial, %.0f us with %d threads, speedup %.2fx\n",
+         serialUs, parallelUs, jobsThreads(), serialUs / parallelUs);
+  return testExit("jobs_test");
+}
@@ -0,0 +1,42 @@
+#pragma once
+// Host stand-ins for the Arduino-ESP32 calls the apps make, just enough
+// to compile an app's main.cpp into a host test. Time stands still and
+// the heap is plain malloc.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(p)  (*(const uint8_t*)(p))
+#define pgm_read_word(p)  (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(p))  // also used for pointers in flash tables
+
+#define MALLOC_CAP_INTERNAL 1
+#define MALLOC_CAP_8BIT     2
+#define MALLOC_CAP_DMA      4
+#define MALLOC_CAP_SPIRAM   8
+#define GPIO_NUM_4          4
+
+inline uint32_t millis() { return 0; }
+inline uint32_t micros() { return 0; }
+inline void delay(uint32_t) {}
+inline long random(long lo, long hi) { return lo + rand() % (hi - lo); }
+inline long random(long hi) { return rand() % hi; }
+inline uint32_t esp_random() { return (uint32_t)rand(); }
+inline void* ps_malloc(size_t n) { return malloc(n); }
+inline void* heap_caps_malloc(size_t n, uint32_t) { return malloc(n); }
+inline void heap_caps_free(void* p) { free(p); }
+inline bool setCpuFrequencyMhz(uint32_t) { return true; }
+
+struct HostSerial {
+  void begin(int) {}
+  template <class... A> void printf(const char*, A...) {}
+  void println(const char* = "") {}
+  void print(const char*) {}
+};
+inline HostSerial Serial;
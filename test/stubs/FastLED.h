@@ -0,0 +1,18 @@
+#pragma once
+// Host stand-in for FastLED: accepts and drops everything
+
+#include <stdint.h>
+
+struct CRGB {
+  uint8_t r, g, b;
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t r_, uint8_t g_, uint8_t b_) : r(r_), g(g_), b(b_) {}
+};
+enum { WS2812B };
+enum { GRB };
+struct HostFastLED {
+  template <int Chip, int Pin, int Order> void addLeds(CRGB*, int) {}
+  void setBrightness(int) {}
+  void show() {}
+};
+inline HostFastLED FastLED;
@@ -0,0 +1,67 @@
+#pragma once
+// Host stand-in for M5Unified/M5GFX: a display and sprites that keep
+// their pixels in memory and push nowhere, so an app's update and render
+// code can run in a host test.
+
+#include "Arduino.h"
+
+namespace lgfx {
+struct swap565_t { uint16_t raw; };
+}
+
+struct LovyanGFX {
+  int width() const { return 320; }
+  int height() const { return 240; }
+  void setColorDepth(int) {}
+  int getRotation() { return 0; }
+  void setRotation(int) {}
+  void startWrite() {}
+  void endWrite() {}
+  void display() {}
+  void setClipRect(int, int, int, int) {}
+  void clearClipRect() {}
+  void waitDMA() {}
+  void pushImage(int, int, int, int, const uint8_t*) {}
+  void pushImageDMA(int, int, int, int, const uint8_t*) {}
+  void pushImageDMA(int, int, int, int, const lgfx::swap565_t*) {}
+};
+
+struct M5GFX : LovyanGFX {};
+
+class LGFX_Sprite : public LovyanGFX {
+ public:
+  void* createSprite(int w, int h) {
+    buf_ = calloc(w * h, 1);
+    w_ = w;
+    h_ = h;
+    return buf_;
+  }
+  void setPsram(bool) {}
+  void clear(uint32_t = 0) { if (buf_) memset(buf_, 0, w_ * h_); }
+  void* getBuffer() { return buf_; }
+  int width() const { return w_; }
+  int height() const { return h_; }
+  void pushSprite(LovyanGFX*, int, int) {}
+  bool createPalette() { return true; }
+  void setPaletteColor(size_t, uint8_t, uint8_t, uint8_t) {}
+
+ private:
+  void* buf_ = nullptr;
+  int w_ = 0, h_ = 0;
+};
+
+struct HostTouchDetail { bool wasPressed() { return false; } };
+struct HostTouch { HostTouchDetail getDetail() { return {}; } };
+struct HostButton { bool wasPressed() { return false; } };
+struct HostPower { int32_t getBatteryCurrent() { return 0; } };
+struct HostConfig {};
+struct HostM5 {
+  M5GFX Display;
+  HostTouch Touch;
+  HostPower Power;
+  HostButton BtnA, BtnB;
+  HostConfig config() { return {}; }
+  void begin(HostConfig) {}
+  void update() {}
+};
+inline HostM5 M5;